@@ -1741,7 +1741,10 @@
 
 #define ER_QPROC_RESULT_CACHE_INVALID		    -1361
 
-#define ER_LAST_ERROR                               -1362
+#define ER_PB_TABLE_PAGE_TYPE                       -1362
+#define ER_PB_NUMA_BIND_FAILED                      -1363
+
+#define ER_LAST_ERROR                               -1364
 
 /*
  * CAUTION!
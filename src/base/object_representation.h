@@ -456,6 +456,10 @@ OR_PUT_DOUBLE (char *ptr, double val)
 #define OR_FIXED_ATTRIBUTES_OFFSET_INTERNAL(ptr, nvars, offset_size) \
   (OR_HEADER_SIZE (ptr) + OR_VAR_TABLE_SIZE_INTERNAL (nvars, offset_size))
 
+/* offset of the fixed attributes, using the variable offset size recorded in the object header */
+#define OR_FIXED_ATTRIBUTES_OFFSET_BY_OBJ(obj, nvars) \
+  (OR_FIXED_ATTRIBUTES_OFFSET_INTERNAL (obj, nvars, OR_GET_OFFSET_SIZE (obj)))
+
 /* OBJECT HEADER LAYOUT */
 /* header fixed-size in non-MVCC only, in MVCC the header has variable size */
 #define OR_HEADER_SIZE(ptr) (or_header_size ((char *) (ptr)))
@@ -245,6 +245,11 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* TODO: Count and timer */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_WAITED_ON_OBJECTS, "Num_object_locks_waits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_WAITED_TIME_ON_OBJECTS, "Num_object_locks_time_waited_usec"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LK_DEADLOCK_DETECT_TIME_COUNTERS, "lock_deadlock_detect"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_DEADLOCK_CYCLES, "Num_lock_deadlock_cycles"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_DEADLOCK_CYCLES_ON_SUSPEND, "Num_lock_deadlock_cycles_on_suspend"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_ELIDED_ON_OBJECTS, "Num_object_locks_elided"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_INFLATED_ON_OBJECTS, "Num_object_locks_inflated"),
 
   /* Execution statistics for transactions */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TRAN_NUM_COMMITS, "Num_tran_commits"),
@@ -269,6 +274,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_SPLITS, "Num_btree_splits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_MERGES, "Num_btree_merges"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_GET_STATS, "Num_btree_get_stats"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_OPTIMISTIC_DESCENTS, "Num_btree_optimistic_descents"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_OPTIMISTIC_DESCENT_FAILS, "Num_btree_optimistic_descent_fails"),
 
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_ONLINE_LOAD, "btree_online_load"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_ONLINE_INSERT_TASK, "btree_online_insert_task"),
@@ -299,6 +306,9 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* Execution statistics for external sort */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_SORT_NUM_IO_PAGES, "Num_sort_io_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_SORT_NUM_DATA_PAGES, "Num_sort_data_pages"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_SORT_RUN_GENERATION_TIME_COUNTERS, "sort_run_generation"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_SORT_MERGE_TIME_COUNTERS, "sort_merge"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_SORT_NUM_PARALLEL_TASKS, "Num_sort_parallel_tasks"),
 
   /* Execution statistics for network communication */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_NUM_REQUESTS, "Num_network_requests"),
@@ -312,6 +322,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PRIOR_LSA_LIST_SIZE, "Num_prior_lsa_list_size"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PRIOR_LSA_LIST_MAXED, "Num_prior_lsa_list_maxed"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PRIOR_LSA_LIST_REMOVED, "Num_prior_lsa_list_removed"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PRIOR_LSA_COMBINED_RECORDS, "Num_prior_lsa_combined_records"),
 
   /* HA replication delay */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_HA_REPL_DELAY, "Time_ha_replication_delay"),
@@ -436,6 +447,7 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_TIME_COUNTERS, "Time_get_snapshot_acquire_time"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS, "Count_get_snapshot_retry"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS, "Count_get_snapshot_reuse"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS, "Time_tran_complete_time"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS, "compute_oldest_visible"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS, "Count_get_oldest_mvcc_retry"),
@@ -446,6 +458,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_VACUUM_DATA_HIT_RATIO, "Vacuum_data_page_buffer_hit_ratio"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_VACUUM_EFFICIENCY, "Vacuum_page_efficiency_ratio"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_VACUUM_FETCH_RATIO, "Vacuum_page_fetch_ratio"),
+  PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_COMPRESSED_CACHE_SPACE_RATIO, "Data_page_compressed_cache_space_ratio"),
 
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_PAGE_LOCK_ACQUIRE_TIME_10USEC, "Data_page_fix_lock_acquire_time_msec"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_PAGE_HOLD_ACQUIRE_TIME_10USEC, "Data_page_fix_hold_acquire_time_msec"),
@@ -541,6 +554,29 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_PRV_GET_BIG, "Num_lfcq_prv_get_big"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_SHR_GET_CALLS, "Num_lfcq_shr_get_total_calls"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_SHR_GET_EMPTY, "Num_lfcq_shr_get_empty"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_REQUESTS, "Num_data_page_read_ahead_requests"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_DROPPED, "Num_data_page_read_ahead_dropped"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_IOREADS, "Num_data_page_read_ahead_ioreads"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_PAGES, "Num_data_page_read_ahead_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_HITS, "Num_data_page_read_ahead_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_MISSES, "Num_data_page_read_ahead_misses"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_BULK_READ_RING_ADMISSIONS, "Num_data_page_bulk_read_ring_admissions"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_BULK_READ_RING_REUSES, "Num_data_page_bulk_read_ring_reuses"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_BULK_READ_RING_SKIPS, "Num_data_page_bulk_read_ring_skips"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_WARMUP_DUMPS, "Num_data_page_warmup_dumps"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_WARMUP_PAGES, "Num_data_page_warmup_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_VICTIM_LOCAL_NODE_SHARED_LRU_SUCCESS,
+				  "Num_victim_local_node_shared_lru_success"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_HITS, "Num_data_page_compressed_cache_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_MISSES, "Num_data_page_compressed_cache_misses"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_STORES, "Num_data_page_compressed_cache_stores"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_SKIPS, "Num_data_page_compressed_cache_skips"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_EVICTIONS, "Num_data_page_compressed_cache_evictions"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_PAGE_BYTES, "Data_page_compressed_cache_page_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_COMPRESSED_CACHE_STORED_BYTES,
+				  "Data_page_compressed_cache_stored_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_HASH_OPTIMISTIC_HITS, "Num_data_page_hash_optimistic_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_HASH_OPTIMISTIC_RETRIES, "Num_data_page_hash_optimistic_retries"),
 
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_DWB_FLUSH_BLOCK_TIME_COUNTERS, "DWB_flush_block"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_DWB_FILE_SYNC_HELPER_TIME_COUNTERS, "DWB_file_sync_helper"),
@@ -555,6 +591,19 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS, "Log_LZ4_compress"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS, "Log_LZ4_decompress"),
 
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_COMMIT_WAIT_TIME_COUNTERS, "Log_commit_wait"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_COMMIT_WAIT_UNDER_100USEC, "Num_log_commit_wait_under_100usec"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_COMMIT_WAIT_UNDER_1MSEC, "Num_log_commit_wait_under_1msec"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_COMMIT_WAIT_UNDER_10MSEC, "Num_log_commit_wait_under_10msec"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_COMMIT_WAIT_UNDER_100MSEC, "Num_log_commit_wait_under_100msec"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_COMMIT_WAIT_OVER_100MSEC, "Num_log_commit_wait_over_100msec"),
+
+  /* Log shipping statistics */
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOGWR_SEND_TIME_COUNTERS, "Log_ship_send"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOGWR_NUM_SENT_PAGES, "Num_log_ship_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOGWR_NUM_RAW_BYTES, "Num_log_ship_raw_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOGWR_NUM_SENT_BYTES, "Num_log_ship_sent_bytes"),
+
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_HIGH_PRIO, "Num_alloc_bcb_wait_threads_high_priority"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_LOW_PRIO, "Num_alloc_bcb_wait_threads_low_priority"),
@@ -1795,6 +1844,10 @@ perfmon_server_calc_stats (UINT64 * stats)
   stats[pstat_Metadata[PSTAT_VACUUM_DATA_HIT_RATIO].start_offset] =
     SAFE_DIV (total_fix_vacuum_hit * 100 * 100, total_fix_vacuum);
 
+  stats[pstat_Metadata[PSTAT_PB_COMPRESSED_CACHE_SPACE_RATIO].start_offset] =
+    SAFE_DIV (stats[pstat_Metadata[PSTAT_PB_COMPRESSED_CACHE_STORED_BYTES].start_offset] * 100 * 100,
+	      stats[pstat_Metadata[PSTAT_PB_COMPRESSED_CACHE_PAGE_BYTES].start_offset]);
+
   stats[pstat_Metadata[PSTAT_PB_HIT_RATIO].start_offset] =
     SAFE_DIV ((stats[pstat_Metadata[PSTAT_PB_NUM_FETCHES].start_offset] -
 	       stats[pstat_Metadata[PSTAT_PB_NUM_IOREADS].start_offset]) * 100 * 100,
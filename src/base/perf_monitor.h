@@ -321,6 +321,11 @@ typedef enum
   PSTAT_LK_NUM_WAITED_ON_OBJECTS,
   PSTAT_LK_NUM_WAITED_TIME_ON_OBJECTS,	/* include this to avoid client-server compat issue even if extended stats are
 					 * disabled */
+  PSTAT_LK_DEADLOCK_DETECT_TIME_COUNTERS,
+  PSTAT_LK_NUM_DEADLOCK_CYCLES,
+  PSTAT_LK_NUM_DEADLOCK_CYCLES_ON_SUSPEND,
+  PSTAT_LK_NUM_ELIDED_ON_OBJECTS,
+  PSTAT_LK_NUM_INFLATED_ON_OBJECTS,
 
   /* Execution statistics for transactions */
   PSTAT_TRAN_NUM_COMMITS,
@@ -345,6 +350,8 @@ typedef enum
   PSTAT_BT_NUM_SPLITS,
   PSTAT_BT_NUM_MERGES,
   PSTAT_BT_NUM_GET_STATS,
+  PSTAT_BT_NUM_OPTIMISTIC_DESCENTS,
+  PSTAT_BT_NUM_OPTIMISTIC_DESCENT_FAILS,
 
   PSTAT_BT_ONLINE_LOAD,
   PSTAT_BT_ONLINE_INSERT_TASK,
@@ -374,6 +381,9 @@ typedef enum
   /* Execution statistics for external sort */
   PSTAT_SORT_NUM_IO_PAGES,
   PSTAT_SORT_NUM_DATA_PAGES,
+  PSTAT_SORT_RUN_GENERATION_TIME_COUNTERS,
+  PSTAT_SORT_MERGE_TIME_COUNTERS,
+  PSTAT_SORT_NUM_PARALLEL_TASKS,
 
   /* Execution statistics for network communication */
   PSTAT_NET_NUM_REQUESTS,
@@ -387,6 +397,7 @@ typedef enum
   PSTAT_PRIOR_LSA_LIST_SIZE,	/* kbytes */
   PSTAT_PRIOR_LSA_LIST_MAXED,
   PSTAT_PRIOR_LSA_LIST_REMOVED,
+  PSTAT_PRIOR_LSA_COMBINED_RECORDS,
 
   /* HA replication delay */
   PSTAT_HA_REPL_DELAY,
@@ -498,6 +509,7 @@ typedef enum
   /* Log statistics */
   PSTAT_LOG_SNAPSHOT_TIME_COUNTERS,
   PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
+  PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS,
   PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS,
@@ -513,6 +525,8 @@ typedef enum
   PSTAT_PB_VACUUM_EFFICIENCY,
   /* (100 x Number of unfix from vacuum / total num of unfix) x 100 */
   PSTAT_PB_VACUUM_FETCH_RATIO,
+  /* (100 x compressed bytes of pages stored in compressed cache / their page bytes) x 100 */
+  PSTAT_PB_COMPRESSED_CACHE_SPACE_RATIO,
   /* total time to acquire page lock (stored as 10 usec unit, displayed as miliseconds) */
   PSTAT_PB_PAGE_LOCK_ACQUIRE_TIME_10USEC,
   /* total time to acquire page hold (stored as 10 usec unit, displayed as miliseconds) */
@@ -611,6 +625,33 @@ typedef enum
   PSTAT_PB_LFCQ_LRU_PRV_GET_BIG,
   PSTAT_PB_LFCQ_LRU_SHR_GET_CALLS,
   PSTAT_PB_LFCQ_LRU_SHR_GET_EMPTY,
+  /* sequential read-ahead */
+  PSTAT_PB_READ_AHEAD_REQUESTS,
+  PSTAT_PB_READ_AHEAD_DROPPED,
+  PSTAT_PB_READ_AHEAD_IOREADS,
+  PSTAT_PB_READ_AHEAD_PAGES,
+  PSTAT_PB_READ_AHEAD_HITS,
+  PSTAT_PB_READ_AHEAD_MISSES,
+  /* scan-resistant admission of large sequential scans */
+  PSTAT_PB_BULK_READ_RING_ADMISSIONS,
+  PSTAT_PB_BULK_READ_RING_REUSES,
+  PSTAT_PB_BULK_READ_RING_SKIPS,
+  /* buffer pool warm-up */
+  PSTAT_PB_WARMUP_DUMPS,
+  PSTAT_PB_WARMUP_PAGES,
+  /* NUMA-aware victimization */
+  PSTAT_PB_VICTIM_LOCAL_NODE_SHARED_LRU_SUCCESS,
+  /* compressed cache of evicted pages */
+  PSTAT_PB_COMPRESSED_CACHE_HITS,
+  PSTAT_PB_COMPRESSED_CACHE_MISSES,
+  PSTAT_PB_COMPRESSED_CACHE_STORES,
+  PSTAT_PB_COMPRESSED_CACHE_SKIPS,
+  PSTAT_PB_COMPRESSED_CACHE_EVICTIONS,
+  PSTAT_PB_COMPRESSED_CACHE_PAGE_BYTES,
+  PSTAT_PB_COMPRESSED_CACHE_STORED_BYTES,
+  /* hash chain lookups without hash mutex */
+  PSTAT_PB_HASH_OPTIMISTIC_HITS,
+  PSTAT_PB_HASH_OPTIMISTIC_RETRIES,
 
   /* DWB statistics */
   PSTAT_DWB_FLUSH_BLOCK_TIME_COUNTERS,
@@ -626,6 +667,20 @@ typedef enum
   PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS,
   PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS,
 
+  /* time committers wait for their log to be flushed, and its distribution */
+  PSTAT_LOG_COMMIT_WAIT_TIME_COUNTERS,
+  PSTAT_LOG_COMMIT_WAIT_UNDER_100USEC,
+  PSTAT_LOG_COMMIT_WAIT_UNDER_1MSEC,
+  PSTAT_LOG_COMMIT_WAIT_UNDER_10MSEC,
+  PSTAT_LOG_COMMIT_WAIT_UNDER_100MSEC,
+  PSTAT_LOG_COMMIT_WAIT_OVER_100MSEC,
+
+  /* log pages shipped to copylogdb */
+  PSTAT_LOGWR_SEND_TIME_COUNTERS,
+  PSTAT_LOGWR_NUM_SENT_PAGES,
+  PSTAT_LOGWR_NUM_RAW_BYTES,
+  PSTAT_LOGWR_NUM_SENT_BYTES,
+
   /* peeked stats */
   PSTAT_PB_WAIT_THREADS_HIGH_PRIO,
   PSTAT_PB_WAIT_THREADS_LOW_PRIO,
@@ -48,6 +48,15 @@
 #endif
 #endif
 
+#if defined (LINUX)
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif /* LINUX */
+
 #include "porting.h"
 
 #if !defined(HAVE_ASPRINTF)
@@ -2655,3 +2664,374 @@ msleep (const long msec)
 
   return error;
 }
+
+#if defined (LINUX)
+#define OS_NUMA_MAX_NODES 64
+#define OS_NUMA_MAX_CPUS 1024
+#define OS_NUMA_NODE_PATH "/sys/devices/system/node"
+/* mbind (2) constants; numaif.h is not required */
+#define OS_NUMA_MPOL_BIND 2
+#define OS_NUMA_MPOL_MF_MOVE (1 << 1)
+
+static int os_Numa_node_count = 0;	/* 0 if not initialized yet */
+static short os_Numa_cpu_node[OS_NUMA_MAX_CPUS];
+
+static void os_numa_initialize (void);
+static int os_numa_read_cpulist (int node, cpu_set_t * cpu_set);
+
+/*
+ * os_numa_read_cpulist() - read the cpus of a NUMA node
+ *   return: number of cpus of node, or -1 if node does not exist
+ *   node(in): NUMA node
+ *   cpu_set(out): cpus of node
+ */
+static int
+os_numa_read_cpulist (int node, cpu_set_t * cpu_set)
+{
+  char path[PATH_MAX];
+  char cpulist[4096];
+  char *p, *end;
+  long first, last, cpu;
+  int count = 0;
+  FILE *fp;
+
+  CPU_ZERO (cpu_set);
+
+  snprintf (path, sizeof (path), "%s/node%d/cpulist", OS_NUMA_NODE_PATH, node);
+  fp = fopen (path, "r");
+  if (fp == NULL)
+    {
+      return -1;
+    }
+  if (fgets (cpulist, sizeof (cpulist), fp) == NULL)
+    {
+      cpulist[0] = '\0';
+    }
+  fclose (fp);
+
+  /* format is a comma separated list of cpus or cpu ranges, e.g. 0-3,8-11 */
+  p = cpulist;
+  while (*p != '\0' && *p != '\n')
+    {
+      first = strtol (p, &end, 10);
+      if (end == p)
+	{
+	  break;
+	}
+      last = first;
+      if (*end == '-')
+	{
+	  p = end + 1;
+	  last = strtol (p, &end, 10);
+	}
+      for (cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+	{
+	  CPU_SET (cpu, cpu_set);
+	  count++;
+	}
+      p = (*end == ',') ? end + 1 : end;
+    }
+
+  return count;
+}
+
+/*
+ * os_numa_initialize() - read NUMA topology of system
+ *   return: void
+ */
+static void
+os_numa_initialize (void)
+{
+  cpu_set_t cpu_set;
+  int node, cpu;
+  int node_count = 1;
+
+  memset (os_Numa_cpu_node, 0, sizeof (os_Numa_cpu_node));
+
+  for (node = 0; node < OS_NUMA_MAX_NODES; node++)
+    {
+      if (os_numa_read_cpulist (node, &cpu_set) < 0)
+	{
+	  continue;
+	}
+      for (cpu = 0; cpu < OS_NUMA_MAX_CPUS && cpu < CPU_SETSIZE; cpu++)
+	{
+	  if (CPU_ISSET (cpu, &cpu_set))
+	    {
+	      os_Numa_cpu_node[cpu] = (short) node;
+	    }
+	}
+      node_count = node + 1;
+    }
+
+  os_Numa_node_count = node_count;
+}
+#endif /* LINUX */
+
+/*
+ * os_numa_get_node_count() - get number of NUMA nodes of system
+ *   return: number of NUMA nodes; 1 if system is not NUMA or it is not known
+ */
+int
+os_numa_get_node_count (void)
+{
+#if defined (LINUX)
+  if (os_Numa_node_count == 0)
+    {
+      os_numa_initialize ();
+    }
+  return os_Numa_node_count;
+#else /* !LINUX */
+  return 1;
+#endif /* !LINUX */
+}
+
+/*
+ * os_numa_get_current_node() - get NUMA node of the cpu running current thread
+ *   return: NUMA node
+ */
+int
+os_numa_get_current_node (void)
+{
+#if defined (LINUX)
+  int cpu;
+
+  if (os_numa_get_node_count () <= 1)
+    {
+      return 0;
+    }
+
+  cpu = sched_getcpu ();
+  if (cpu < 0 || cpu >= OS_NUMA_MAX_CPUS)
+    {
+      return 0;
+    }
+  return os_Numa_cpu_node[cpu];
+#else /* !LINUX */
+  return 0;
+#endif /* !LINUX */
+}
+
+/*
+ * os_numa_bind_memory() - place memory on a NUMA node
+ *   return: 0 on success, otherwise -1
+ *   addr(in): start of memory
+ *   size(in): size of memory
+ *   node(in): NUMA node
+ *
+ * Note: only the system pages fully contained in given memory are placed.
+ */
+int
+os_numa_bind_memory (void *addr, size_t size, int node)
+{
+#if defined (LINUX)
+  unsigned long nodemask[OS_NUMA_MAX_NODES / (8 * sizeof (unsigned long)) + 1];
+  size_t page_size;
+  uintptr_t start, end;
+
+  if (node < 0 || node >= OS_NUMA_MAX_NODES)
+    {
+      return -1;
+    }
+
+  page_size = (size_t) sysconf (_SC_PAGESIZE);
+  start = ((uintptr_t) addr + page_size - 1) & ~((uintptr_t) page_size - 1);
+  end = ((uintptr_t) addr + size) & ~((uintptr_t) page_size - 1);
+  if (start >= end)
+    {
+      return 0;
+    }
+
+  memset (nodemask, 0, sizeof (nodemask));
+  nodemask[node / (8 * sizeof (unsigned long))] |= 1UL << (node % (8 * sizeof (unsigned long)));
+
+  if (syscall (SYS_mbind, (void *) start, (unsigned long) (end - start), OS_NUMA_MPOL_BIND, nodemask,
+	       (unsigned long) OS_NUMA_MAX_NODES + 1, OS_NUMA_MPOL_MF_MOVE) != 0)
+    {
+      return -1;
+    }
+  return 0;
+#else /* !LINUX */
+  return -1;
+#endif /* !LINUX */
+}
+
+/*
+ * os_numa_bind_thread_to_node() - let current thread run only on the cpus of a NUMA node
+ *   return: 0 on success, otherwise -1
+ *   node(in): NUMA node
+ */
+int
+os_numa_bind_thread_to_node (int node)
+{
+#if defined (LINUX)
+  cpu_set_t cpu_set;
+
+  if (os_numa_read_cpulist (node, &cpu_set) <= 0)
+    {
+      return -1;
+    }
+  return sched_setaffinity (0, sizeof (cpu_set), &cpu_set) == 0 ? 0 : -1;
+#else /* !LINUX */
+  return -1;
+#endif /* !LINUX */
+}
+
+#if defined (LINUX)
+/* mmap (2) huge page size selectors; not defined by older system headers */
+#define OS_LARGE_PAGE_MAP_HUGE_SHIFT 26
+#define OS_LARGE_PAGE_MAP_HUGE_2MB (21 << OS_LARGE_PAGE_MAP_HUGE_SHIFT)
+#define OS_LARGE_PAGE_MAP_HUGE_1GB (30 << OS_LARGE_PAGE_MAP_HUGE_SHIFT)
+#if !defined (MAP_HUGETLB)
+#define MAP_HUGETLB 0x40000
+#endif /* !MAP_HUGETLB */
+#if !defined (MADV_HUGEPAGE)
+#define MADV_HUGEPAGE 14
+#endif /* !MADV_HUGEPAGE */
+#endif /* LINUX */
+
+/*
+ * os_large_page_size() - get the size of pages of given type
+ *   return: page size
+ *   type(in): page type
+ *
+ * Note: memory of a mapping is placed (e.g. by os_numa_bind_memory) in units of this size.
+ */
+size_t
+os_large_page_size (OS_LARGE_PAGE_TYPE type)
+{
+  switch (type)
+    {
+    case OS_LARGE_PAGE_1G:
+      return (size_t) 1024 * 1024 * 1024;
+    case OS_LARGE_PAGE_2M:
+    case OS_LARGE_PAGE_TRANSPARENT:
+      /* transparent huge pages are used only for fully covered 2MB ranges */
+      return (size_t) 2 * 1024 * 1024;
+    default:
+#if defined (LINUX)
+      return (size_t) sysconf (_SC_PAGESIZE);
+#else /* !LINUX */
+      /* large pages are not allocated; the size only matters to os_numa_bind_memory, which is not supported */
+      return (size_t) 4096;
+#endif /* !LINUX */
+    }
+}
+
+/*
+ * os_alloc_large_pages() - allocate a large long-lived memory region backed by huge pages
+ *   return: zeroed memory aligned to system page size, or NULL if huge pages are not supported or memory cannot be
+ *           mapped
+ *   size(in): size of memory
+ *   type_out(out): type of pages backing the memory
+ *
+ * Note: explicit huge pages (hugetlbfs) are tried first, 1GB pages only for regions of at least 1GB. If the system
+ *       has no free explicit huge pages, the memory is mapped with ordinary pages and advised for transparent huge
+ *       pages. Free the memory with os_free_large_pages.
+ */
+void *
+os_alloc_large_pages (size_t size, OS_LARGE_PAGE_TYPE * type_out)
+{
+#if defined (LINUX)
+  static const OS_LARGE_PAGE_TYPE types[] = { OS_LARGE_PAGE_1G, OS_LARGE_PAGE_2M };
+  static const int type_flags[] = { OS_LARGE_PAGE_MAP_HUGE_1GB, OS_LARGE_PAGE_MAP_HUGE_2MB };
+  size_t page_size, map_size;
+  void *ptr;
+  unsigned int i;
+
+  assert (type_out != NULL);
+  *type_out = OS_LARGE_PAGE_NONE;
+
+  if (size == 0)
+    {
+      return NULL;
+    }
+
+  for (i = 0; i < sizeof (types) / sizeof (types[0]); i++)
+    {
+      page_size = os_large_page_size (types[i]);
+      if (types[i] == OS_LARGE_PAGE_1G && size < page_size)
+	{
+	  /* do not waste most of a 1GB page */
+	  continue;
+	}
+
+      map_size = (size + page_size - 1) & ~(page_size - 1);
+      ptr = mmap (NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | type_flags[i],
+		  -1, 0);
+      if (ptr != MAP_FAILED)
+	{
+	  *type_out = types[i];
+	  return ptr;
+	}
+    }
+
+  /* no explicit huge pages; fall back to ordinary pages that the kernel may promote */
+  map_size = (size + os_large_page_size (OS_LARGE_PAGE_TRANSPARENT) - 1)
+    & ~(os_large_page_size (OS_LARGE_PAGE_TRANSPARENT) - 1);
+  ptr = mmap (NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED)
+    {
+      return NULL;
+    }
+  if (madvise (ptr, map_size, MADV_HUGEPAGE) == 0)
+    {
+      *type_out = OS_LARGE_PAGE_TRANSPARENT;
+    }
+  else
+    {
+      /* transparent huge pages are disabled; still a valid mapping */
+      *type_out = OS_LARGE_PAGE_NONE_MAPPED;
+    }
+  return ptr;
+#else /* !LINUX */
+  *type_out = OS_LARGE_PAGE_NONE;
+  return NULL;
+#endif /* !LINUX */
+}
+
+/*
+ * os_free_large_pages() - free memory allocated by os_alloc_large_pages
+ *   return: void
+ *   ptr(in): memory to free
+ *   size(in): size given at allocation
+ *   type(in): page type returned at allocation
+ */
+void
+os_free_large_pages (void *ptr, size_t size, OS_LARGE_PAGE_TYPE type)
+{
+#if defined (LINUX)
+  size_t page_size;
+
+  if (ptr == NULL)
+    {
+      return;
+    }
+
+  page_size = os_large_page_size (type == OS_LARGE_PAGE_NONE_MAPPED ? OS_LARGE_PAGE_TRANSPARENT : type);
+  (void) munmap (ptr, (size + page_size - 1) & ~(page_size - 1));
+#else /* !LINUX */
+  assert (ptr == NULL);
+#endif /* !LINUX */
+}
+
+/*
+ * os_large_page_type_name() - get printable name of a page type
+ *   return: name
+ *   type(in): page type
+ */
+const char *
+os_large_page_type_name (OS_LARGE_PAGE_TYPE type)
+{
+  switch (type)
+    {
+    case OS_LARGE_PAGE_1G:
+      return "1GB huge pages";
+    case OS_LARGE_PAGE_2M:
+      return "2MB huge pages";
+    case OS_LARGE_PAGE_TRANSPARENT:
+      return "transparent huge pages";
+    default:
+      return "ordinary pages";
+    }
+}
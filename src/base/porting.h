@@ -498,6 +498,25 @@ extern char *getuserid (char *string, int size);
  * wrapper for OS dependent operations
  */
 extern int os_rename_file (const char *src_path, const char *dest_path);
+extern int os_numa_get_node_count (void);
+extern int os_numa_get_current_node (void);
+extern int os_numa_bind_memory (void *addr, size_t size, int node);
+extern int os_numa_bind_thread_to_node (int node);
+
+/* pages backing memory allocated by os_alloc_large_pages */
+typedef enum
+{
+  OS_LARGE_PAGE_NONE = 0,	/* not allocated by os_alloc_large_pages */
+  OS_LARGE_PAGE_NONE_MAPPED,	/* mapped, but with ordinary pages */
+  OS_LARGE_PAGE_TRANSPARENT,	/* mapped and advised for transparent huge pages */
+  OS_LARGE_PAGE_2M,		/* explicit 2MB huge pages */
+  OS_LARGE_PAGE_1G		/* explicit 1GB huge pages */
+} OS_LARGE_PAGE_TYPE;
+
+extern void *os_alloc_large_pages (size_t size, OS_LARGE_PAGE_TYPE * type_out);
+extern void os_free_large_pages (void *ptr, size_t size, OS_LARGE_PAGE_TYPE type);
+extern const char *os_large_page_type_name (OS_LARGE_PAGE_TYPE type);
+extern size_t os_large_page_size (OS_LARGE_PAGE_TYPE type);
 
 /* os_send_kill() - send the KILL signal to ourselves */
 #if defined (WINDOWS)
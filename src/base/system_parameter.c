@@ -753,6 +753,42 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_ENABLE_MEMORY_MONITORING "enable_memory_monitoring"
 
+#define PRM_NAME_PB_READ_AHEAD_PAGES "data_buffer_read_ahead_pages"
+
+#define PRM_NAME_IO_URING_QUEUE_DEPTH "io_uring_queue_depth"
+
+#define PRM_NAME_DATA_VOLUME_DIRECT_IO "data_volume_direct_io"
+
+#define PRM_NAME_PB_BULK_READ_RING_PAGES "data_buffer_bulk_read_ring_pages"
+
+#define PRM_NAME_PB_WARMUP "data_buffer_warmup"
+
+#define PRM_NAME_PB_WARMUP_DUMP_INTERVAL_SECS "data_buffer_warmup_dump_interval_in_secs"
+
+#define PRM_NAME_PB_NUMA_AWARE "data_buffer_numa_aware"
+
+#define PRM_NAME_THREAD_WORKER_NUMA_PINNING "thread_worker_numa_pinning"
+
+#define PRM_NAME_USE_HUGE_PAGES "use_huge_pages"
+
+#define PRM_NAME_PB_COMPRESSED_CACHE_SIZE "data_buffer_compressed_cache_size"
+
+#define PRM_NAME_LOG_GROUP_COMMIT_ADAPTIVE "log_group_commit_adaptive"
+
+#define PRM_NAME_LOG_READ_AHEAD_PAGES "log_read_ahead_pages"
+
+#define PRM_NAME_HA_COPY_LOG_COMPRESSION "ha_copy_log_compression"
+
+#define PRM_NAME_LK_ELIDE_INSERT_LOCKS "lock_elide_insert_locks"
+
+#define PRM_NAME_LOG_CHECKPOINT_MAX_REDO_NPAGES "checkpoint_max_redo_npages"
+
+#define PRM_NAME_PARALLEL_SCAN_DEGREE "parallel_scan_degree"
+
+#define PRM_NAME_SORT_PARALLEL_DEGREE "sort_parallel_degree"
+
+#define PRM_NAME_HEAP_SCAN_RAW_FILTER "heap_scan_raw_filter"
+
 /*
  * Note about ERROR_LIST and INTEGER_LIST type
  * ERROR_LIST type is an array of bool type with the size of -(ER_LAST_ERROR)
@@ -2457,6 +2493,96 @@ static UINT64 prm_max_subquery_cache_size_lower = 0;	/* 0 */
 static UINT64 prm_max_subquery_cache_size_upper = 16 * 1024 * 1024;	/* 16 MB */
 static unsigned int prm_max_subquery_cache_size_flag = 0;
 
+int PRM_PB_READ_AHEAD_PAGES = 0;
+static int prm_pb_read_ahead_pages_default = 0;
+static int prm_pb_read_ahead_pages_lower = 0;
+static int prm_pb_read_ahead_pages_upper = 128;
+static unsigned int prm_pb_read_ahead_pages_flag = 0;
+
+int PRM_IO_URING_QUEUE_DEPTH = 0;
+static int prm_io_uring_queue_depth_default = 0;
+static int prm_io_uring_queue_depth_lower = 0;
+static int prm_io_uring_queue_depth_upper = 4096;
+static unsigned int prm_io_uring_queue_depth_flag = 0;
+
+bool PRM_DATA_VOLUME_DIRECT_IO = false;
+static bool prm_data_volume_direct_io_default = false;
+static unsigned int prm_data_volume_direct_io_flag = 0;
+
+int PRM_PB_BULK_READ_RING_PAGES = 0;
+static int prm_pb_bulk_read_ring_pages_default = 0;
+static int prm_pb_bulk_read_ring_pages_lower = 0;
+static int prm_pb_bulk_read_ring_pages_upper = 1024;
+static unsigned int prm_pb_bulk_read_ring_pages_flag = 0;
+
+bool PRM_PB_WARMUP = false;
+static bool prm_pb_warmup_default = false;
+static unsigned int prm_pb_warmup_flag = 0;
+
+int PRM_PB_WARMUP_DUMP_INTERVAL_SECS = 600;
+static int prm_pb_warmup_dump_interval_secs_default = 600;
+static int prm_pb_warmup_dump_interval_secs_lower = 0;
+static int prm_pb_warmup_dump_interval_secs_upper = 86400;
+static unsigned int prm_pb_warmup_dump_interval_secs_flag = 0;
+
+bool PRM_PB_NUMA_AWARE = false;
+static bool prm_pb_numa_aware_default = false;
+static unsigned int prm_pb_numa_aware_flag = 0;
+
+bool PRM_THREAD_WORKER_NUMA_PINNING = false;
+static bool prm_thread_worker_numa_pinning_default = false;
+static unsigned int prm_thread_worker_numa_pinning_flag = 0;
+
+bool PRM_USE_HUGE_PAGES = false;
+static bool prm_use_huge_pages_default = false;
+static unsigned int prm_use_huge_pages_flag = 0;
+
+UINT64 PRM_PB_COMPRESSED_CACHE_SIZE = 0;
+static UINT64 prm_pb_compressed_cache_size_default = 0;
+static UINT64 prm_pb_compressed_cache_size_lower = 0;
+static UINT64 prm_pb_compressed_cache_size_upper = 1024 * 1024 * 1024 * 1024ULL;	/* 1 TB */
+static unsigned int prm_pb_compressed_cache_size_flag = 0;
+
+bool PRM_LOG_GROUP_COMMIT_ADAPTIVE = false;
+static bool prm_log_group_commit_adaptive_default = false;
+static unsigned int prm_log_group_commit_adaptive_flag = 0;
+
+int PRM_LOG_READ_AHEAD_PAGES = 0;
+static int prm_log_read_ahead_pages_default = 0;
+static int prm_log_read_ahead_pages_lower = 0;
+static int prm_log_read_ahead_pages_upper = 65536;
+static unsigned int prm_log_read_ahead_pages_flag = 0;
+
+bool PRM_HA_COPY_LOG_COMPRESSION = false;
+static bool prm_ha_copy_log_compression_default = false;
+static unsigned int prm_ha_copy_log_compression_flag = 0;
+
+bool PRM_LK_ELIDE_INSERT_LOCKS = false;
+static bool prm_lk_elide_insert_locks_default = false;
+static unsigned int prm_lk_elide_insert_locks_flag = 0;
+
+int PRM_LOG_CHECKPOINT_MAX_REDO_NPAGES = 0;
+static int prm_log_checkpoint_max_redo_npages_default = 0;
+static int prm_log_checkpoint_max_redo_npages_lower = 0;
+static int prm_log_checkpoint_max_redo_npages_upper = INT_MAX;
+static unsigned int prm_log_checkpoint_max_redo_npages_flag = 0;
+
+int PRM_PARALLEL_SCAN_DEGREE = 0;
+static int prm_parallel_scan_degree_default = 0;
+static int prm_parallel_scan_degree_lower = 0;
+static int prm_parallel_scan_degree_upper = 64;
+static unsigned int prm_parallel_scan_degree_flag = 0;
+
+int PRM_SORT_PARALLEL_DEGREE = 0;
+static int prm_sort_parallel_degree_default = 0;
+static int prm_sort_parallel_degree_lower = 0;
+static int prm_sort_parallel_degree_upper = 64;
+static unsigned int prm_sort_parallel_degree_flag = 0;
+
+bool PRM_HEAP_SCAN_RAW_FILTER = false;
+static bool prm_heap_scan_raw_filter_default = false;
+static unsigned int prm_heap_scan_raw_filter_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6448,6 +6574,213 @@ SYSPRM_PARAM prm_Def[] = {
    (void *) &prm_max_subquery_cache_size_lower,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_READ_AHEAD_PAGES,
+   PRM_NAME_PB_READ_AHEAD_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_pb_read_ahead_pages_flag,
+   (void *) &prm_pb_read_ahead_pages_default,
+   (void *) &PRM_PB_READ_AHEAD_PAGES,
+   (void *) &prm_pb_read_ahead_pages_upper,
+   (void *) &prm_pb_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IO_URING_QUEUE_DEPTH,
+   PRM_NAME_IO_URING_QUEUE_DEPTH,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_io_uring_queue_depth_flag,
+   (void *) &prm_io_uring_queue_depth_default,
+   (void *) &PRM_IO_URING_QUEUE_DEPTH,
+   (void *) &prm_io_uring_queue_depth_upper,
+   (void *) &prm_io_uring_queue_depth_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_VOLUME_DIRECT_IO,
+   PRM_NAME_DATA_VOLUME_DIRECT_IO,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_data_volume_direct_io_flag,
+   (void *) &prm_data_volume_direct_io_default,
+   (void *) &PRM_DATA_VOLUME_DIRECT_IO,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_BULK_READ_RING_PAGES,
+   PRM_NAME_PB_BULK_READ_RING_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_bulk_read_ring_pages_flag,
+   (void *) &prm_pb_bulk_read_ring_pages_default,
+   (void *) &PRM_PB_BULK_READ_RING_PAGES,
+   (void *) &prm_pb_bulk_read_ring_pages_upper,
+   (void *) &prm_pb_bulk_read_ring_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP,
+   PRM_NAME_PB_WARMUP,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_warmup_flag,
+   (void *) &prm_pb_warmup_default,
+   (void *) &PRM_PB_WARMUP,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP_DUMP_INTERVAL_SECS,
+   PRM_NAME_PB_WARMUP_DUMP_INTERVAL_SECS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_warmup_dump_interval_secs_flag,
+   (void *) &prm_pb_warmup_dump_interval_secs_default,
+   (void *) &PRM_PB_WARMUP_DUMP_INTERVAL_SECS,
+   (void *) &prm_pb_warmup_dump_interval_secs_upper,
+   (void *) &prm_pb_warmup_dump_interval_secs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_NUMA_AWARE,
+   PRM_NAME_PB_NUMA_AWARE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_numa_aware_flag,
+   (void *) &prm_pb_numa_aware_default,
+   (void *) &PRM_PB_NUMA_AWARE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_WORKER_NUMA_PINNING,
+   PRM_NAME_THREAD_WORKER_NUMA_PINNING,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_thread_worker_numa_pinning_flag,
+   (void *) &prm_thread_worker_numa_pinning_default,
+   (void *) &PRM_THREAD_WORKER_NUMA_PINNING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_USE_HUGE_PAGES,
+   PRM_NAME_USE_HUGE_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_use_huge_pages_flag,
+   (void *) &prm_use_huge_pages_default,
+   (void *) &PRM_USE_HUGE_PAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_COMPRESSED_CACHE_SIZE,
+   PRM_NAME_PB_COMPRESSED_CACHE_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_pb_compressed_cache_size_flag,
+   (void *) &prm_pb_compressed_cache_size_default,
+   (void *) &PRM_PB_COMPRESSED_CACHE_SIZE,
+   (void *) &prm_pb_compressed_cache_size_upper,
+   (void *) &prm_pb_compressed_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE,
+   PRM_NAME_LOG_GROUP_COMMIT_ADAPTIVE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_log_group_commit_adaptive_flag,
+   (void *) &prm_log_group_commit_adaptive_default,
+   (void *) &PRM_LOG_GROUP_COMMIT_ADAPTIVE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_READ_AHEAD_PAGES,
+   PRM_NAME_LOG_READ_AHEAD_PAGES,
+   ((PRM_FOR_SERVER)),
+   PRM_INTEGER,
+   &prm_log_read_ahead_pages_flag,
+   (void *) &prm_log_read_ahead_pages_default,
+   (void *) &PRM_LOG_READ_AHEAD_PAGES,
+   (void *) &prm_log_read_ahead_pages_upper,
+   (void *) &prm_log_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HA_COPY_LOG_COMPRESSION,
+   PRM_NAME_HA_COPY_LOG_COMPRESSION,
+   (PRM_FOR_CLIENT | PRM_FOR_HA),
+   PRM_BOOLEAN,
+   &prm_ha_copy_log_compression_flag,
+   (void *) &prm_ha_copy_log_compression_default,
+   (void *) &PRM_HA_COPY_LOG_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LK_ELIDE_INSERT_LOCKS,
+   PRM_NAME_LK_ELIDE_INSERT_LOCKS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_lk_elide_insert_locks_flag,
+   (void *) &prm_lk_elide_insert_locks_default,
+   (void *) &PRM_LK_ELIDE_INSERT_LOCKS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_CHECKPOINT_MAX_REDO_NPAGES,
+   PRM_NAME_LOG_CHECKPOINT_MAX_REDO_NPAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_checkpoint_max_redo_npages_flag,
+   (void *) &prm_log_checkpoint_max_redo_npages_default,
+   (void *) &PRM_LOG_CHECKPOINT_MAX_REDO_NPAGES,
+   (void *) &prm_log_checkpoint_max_redo_npages_upper,
+   (void *) &prm_log_checkpoint_max_redo_npages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_SCAN_DEGREE,
+   PRM_NAME_PARALLEL_SCAN_DEGREE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_parallel_scan_degree_flag,
+   (void *) &prm_parallel_scan_degree_default,
+   (void *) &PRM_PARALLEL_SCAN_DEGREE,
+   (void *) &prm_parallel_scan_degree_upper,
+   (void *) &prm_parallel_scan_degree_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_PARALLEL_DEGREE,
+   PRM_NAME_SORT_PARALLEL_DEGREE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_sort_parallel_degree_flag,
+   (void *) &prm_sort_parallel_degree_default,
+   (void *) &PRM_SORT_PARALLEL_DEGREE,
+   (void *) &prm_sort_parallel_degree_upper,
+   (void *) &prm_sort_parallel_degree_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_SCAN_RAW_FILTER,
+   PRM_NAME_HEAP_SCAN_RAW_FILTER,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_heap_scan_raw_filter_flag,
+   (void *) &prm_heap_scan_raw_filter_default,
+   (void *) &PRM_HEAP_SCAN_RAW_FILTER,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
@@ -486,8 +486,26 @@ enum param_id
 
   PRM_ID_ENABLE_MEMORY_MONITORING,
   PRM_ID_MAX_SUBQUERY_CACHE_SIZE,
+  PRM_ID_PB_READ_AHEAD_PAGES,
+  PRM_ID_IO_URING_QUEUE_DEPTH,
+  PRM_ID_DATA_VOLUME_DIRECT_IO,
+  PRM_ID_PB_BULK_READ_RING_PAGES,
+  PRM_ID_PB_WARMUP,
+  PRM_ID_PB_WARMUP_DUMP_INTERVAL_SECS,
+  PRM_ID_PB_NUMA_AWARE,
+  PRM_ID_THREAD_WORKER_NUMA_PINNING,
+  PRM_ID_USE_HUGE_PAGES,
+  PRM_ID_PB_COMPRESSED_CACHE_SIZE,
+  PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE,
+  PRM_ID_LOG_READ_AHEAD_PAGES,
+  PRM_ID_HA_COPY_LOG_COMPRESSION,
+  PRM_ID_LK_ELIDE_INSERT_LOCKS,
+  PRM_ID_LOG_CHECKPOINT_MAX_REDO_NPAGES,
+  PRM_ID_PARALLEL_SCAN_DEGREE,
+  PRM_ID_SORT_PARALLEL_DEGREE,
+  PRM_ID_HEAP_SCAN_RAW_FILTER,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_MAX_SUBQUERY_CACHE_SIZE
+  PRM_LAST_ID = PRM_ID_HEAP_SCAN_RAW_FILTER
 };
 typedef enum param_id PARAM_ID;
 
@@ -2134,10 +2134,13 @@ net_client_request_with_logwr_context (LOGWR_CONTEXT * ctx_ptr, int request, cha
 	  switch (server_request)
 	    {
 	    case GET_NEXT_LOG_PAGES:
+	    case GET_NEXT_LOG_PAGES_COMPRESSED:
 	      {
 		int length;
 		ptr = or_unpack_int (ptr, (int *) (&length));
-		error = net_client_get_next_log_pages (rc, replybuf, replysize, length);
+		error =
+		  net_client_get_next_log_pages (rc, replybuf, replysize, length,
+						 server_request == GET_NEXT_LOG_PAGES_COMPRESSED);
 	      }
 	      break;
 	    case END_CALLBACK:
@@ -2231,58 +2234,105 @@ net_client_logwr_send_end_msg (int rc, int error)
  *   rc(in): pre-allocated data buffer
  *   replybuf(in): reply argument buffer
  *   replysize(in): reply argument buffer size
- *   ptr(in): pre-allocated data buffer
+ *   length(in): size of the data that follows
+ *   is_compressed(in): whether the log pages were LZ4 compressed by the server
  *
  * Note:
  */
 int
-net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length)
+net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length, bool is_compressed)
 {
   char *reply = NULL;
+  char *recv_area;
+  int recv_size;
   int error;
 
-  if (logwr_Gl.logpg_area_size < length)
+  if (is_compressed)
     {
-      /*
-       * It means log_buffer_size/log_page_size are different between master
-       * and slave.
-       * In this case, we have to disconnect from server and try to reconnect.
-       */
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_CRASHED, 0);
-      return ER_NET_SERVER_CRASHED;
+      /* the compressed pages are received into logpg_zip and unzipped into logpg_area below */
+      if (logwr_Gl.logpg_zip == NULL)
+	{
+	  logwr_Gl.logpg_zip = log_zip_alloc (logwr_Gl.logpg_area_size);
+	}
+      if (logwr_Gl.logpg_unzip == NULL)
+	{
+	  logwr_Gl.logpg_unzip = log_zip_alloc (logwr_Gl.logpg_area_size);
+	}
+      if (logwr_Gl.logpg_zip == NULL || logwr_Gl.logpg_unzip == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
+
+      if (logwr_Gl.logpg_zip->buf_size < length)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_CRASHED, 0);
+	  return ER_NET_SERVER_CRASHED;
+	}
+
+      recv_area = logwr_Gl.logpg_zip->log_data;
+      recv_size = logwr_Gl.logpg_zip->buf_size;
+    }
+  else
+    {
+      if (logwr_Gl.logpg_area_size < length)
+	{
+	  /*
+	   * It means log_buffer_size/log_page_size are different between master
+	   * and slave.
+	   * In this case, we have to disconnect from server and try to reconnect.
+	   */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_CRASHED, 0);
+	  return ER_NET_SERVER_CRASHED;
+	}
+
+      recv_area = logwr_Gl.logpg_area;
+      recv_size = logwr_Gl.logpg_area_size;
     }
 
-  (void) css_queue_receive_data_buffer (rc, logwr_Gl.logpg_area, logwr_Gl.logpg_area_size);
+  (void) css_queue_receive_data_buffer (rc, recv_area, recv_size);
   error = css_receive_data_from_server (rc, &reply, &logwr_Gl.logpg_fill_size);
   if (error != NO_ERROR)
     {
-      COMPARE_AND_FREE_BUFFER (logwr_Gl.logpg_area, reply);
+      COMPARE_AND_FREE_BUFFER (recv_area, reply);
       return set_server_error (error);
     }
-  else
+
+  if (is_compressed)
     {
-      error = logwr_set_hdr_and_flush_info ();
-      if (error != NO_ERROR)
+      if (!log_unzip (logwr_Gl.logpg_unzip, logwr_Gl.logpg_fill_size, reply)
+	  || logwr_Gl.logpg_unzip->data_length > logwr_Gl.logpg_area_size)
 	{
-	  COMPARE_AND_FREE_BUFFER (logwr_Gl.logpg_area, reply);
-	  return error;
+	  COMPARE_AND_FREE_BUFFER (recv_area, reply);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+	  return ER_NET_SERVER_DATA_RECEIVE;
 	}
 
-      switch (logwr_Gl.mode)
-	{
-	case LOGWR_MODE_SYNC:
-	case LOGWR_MODE_SEMISYNC:
-	  error = logwr_write_log_pages ();
-	  break;
-	case LOGWR_MODE_ASYNC:
-	  logwr_Gl.action = (LOGWR_ACTION) (logwr_Gl.action | LOGWR_ACTION_ASYNC_WRITE);
-	  break;
-	default:
-	  break;
-	}
+      memcpy (logwr_Gl.logpg_area, logwr_Gl.logpg_unzip->log_data, logwr_Gl.logpg_unzip->data_length);
+      logwr_Gl.logpg_fill_size = logwr_Gl.logpg_unzip->data_length;
+    }
+
+  error = logwr_set_hdr_and_flush_info ();
+  if (error != NO_ERROR)
+    {
+      COMPARE_AND_FREE_BUFFER (recv_area, reply);
+      return error;
+    }
+
+  switch (logwr_Gl.mode)
+    {
+    case LOGWR_MODE_SYNC:
+    case LOGWR_MODE_SEMISYNC:
+      error = logwr_write_log_pages ();
+      break;
+    case LOGWR_MODE_ASYNC:
+      logwr_Gl.action = (LOGWR_ACTION) (logwr_Gl.action | LOGWR_ACTION_ASYNC_WRITE);
+      break;
+    default:
+      break;
     }
 
-  COMPARE_AND_FREE_BUFFER (logwr_Gl.logpg_area, reply);
+  COMPARE_AND_FREE_BUFFER (recv_area, reply);
   return error;
 }
 
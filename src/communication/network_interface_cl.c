@@ -9411,6 +9411,12 @@ logwr_get_log_pages (LOGWR_CONTEXT * ctx_ptr)
       ptr = or_pack_int64 (request, first_pageid_torecv);
     }
 
+  if (prm_get_bool_value (PRM_ID_HA_COPY_LOG_COMPRESSION))
+    {
+      /* ask the server to send LZ4 compressed log pages */
+      mode = (LOGWR_MODE) (mode | LOGWR_COMPRESS_LOG_PAGES_MASK);
+    }
+
   ptr = or_pack_int (ptr, mode);
   ptr = or_pack_int (ptr, ctx_ptr->last_error);
 
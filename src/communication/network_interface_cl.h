@@ -335,7 +335,7 @@ extern int net_client_request_with_logwr_context (LOGWR_CONTEXT * ctx_ptr, int r
 						  int *replydatasize_ptr1, char **replydata_ptr2,
 						  int *replydatasize_ptr2);
 extern void net_client_logwr_send_end_msg (int rc, int error);
-extern int net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length);
+extern int net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length, bool is_compressed);
 #if defined(ENABLE_UNUSED_FUNCTION)
 extern int net_client_request3 (int request, char *argbuf, int argsize, char *replybuf, int replysize, char *databuf,
 				int datasize, char **replydata_ptr, int *replydatasize_ptr, char **replydata_ptr2,
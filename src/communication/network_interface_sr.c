@@ -7497,10 +7497,11 @@ xio_send_user_prompt_to_client (THREAD_ENTRY * thread_p, FILEIO_REMOTE_PROMPT_TY
  * xlog_send_log_pages_to_client -
  *
  * return:
- * NOTE:
+ * NOTE: is_compressed tells the client that logpg_area holds LZ4 compressed log pages.
  */
 int
-xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpg_area, int area_size, LOGWR_MODE mode)
+xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpg_area, int area_size, LOGWR_MODE mode,
+			       bool is_compressed)
 {
   OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
@@ -7514,7 +7515,7 @@ xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpg_area, int ar
    * by 2 ints, otherwise client will abort due to protocol error
    * Prompt_length tells the receiver how big the followon message is.
    */
-  ptr = or_pack_int (reply, (int) GET_NEXT_LOG_PAGES);
+  ptr = or_pack_int (reply, (int) (is_compressed ? GET_NEXT_LOG_PAGES_COMPRESSED : GET_NEXT_LOG_PAGES));
   ptr = or_pack_int (ptr, (int) area_size);
 
   rc =
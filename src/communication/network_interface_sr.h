@@ -171,7 +171,8 @@ extern int xcallback_console_print (THREAD_ENTRY * thread_p, char *print_str);
 extern int xio_send_user_prompt_to_client (THREAD_ENTRY * thread_p, FILEIO_REMOTE_PROMPT_TYPE prompt_id,
 					   const char *buffer, const char *failure_prompt, int range_low,
 					   int range_high, const char *secondary_prompt, int reprompt_value);
-extern int xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpb_area, int area_size, LOGWR_MODE mode);
+extern int xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpb_area, int area_size, LOGWR_MODE mode,
+					  bool is_compressed);
 extern int xlog_get_page_request_with_reply (THREAD_ENTRY * thread_p, LOG_PAGEID * fpageid_ptr, LOGWR_MODE * mode_ptr,
 					     int timeout);
 extern void shf_get_class_num_objs_and_pages (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
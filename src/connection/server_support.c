@@ -77,6 +77,7 @@
 #include "xserver_interface.h"
 #include "utility.h"
 #include "vacuum.h"
+#include "external_sort.h"
 #if !defined(WINDOWS)
 #include "heartbeat.h"
 #endif
@@ -1401,6 +1402,9 @@ shutdown:
   /* stop vacuum threads. */
   vacuum_stop_workers (thread_p);
 
+  /* stop parallel sort threads. */
+  sort_finalize_parallel_workers ();
+
   // stop load sessions
   cubload::worker_manager_stop_all ();
 
@@ -26350,6 +26350,7 @@ PT_HINT parser_hint_table[] = {
   INIT_PT_HINT("INDEX_LS", PT_HINT_INDEX_LS),
   INIT_PT_HINT("SELECT_RECORD_INFO", PT_HINT_SELECT_RECORD_INFO),
   INIT_PT_HINT("SAMPLING_SCAN", PT_HINT_SAMPLING_SCAN),
+  INIT_PT_HINT("PARALLEL_SCAN", PT_HINT_PARALLEL_SCAN),
   INIT_PT_HINT("SELECT_PAGE_INFO", PT_HINT_SELECT_PAGE_INFO),
   INIT_PT_HINT("SELECT_KEY_INFO", PT_HINT_SELECT_KEY_INFO),
   INIT_PT_HINT("SELECT_BTREE_NODE_INFO", PT_HINT_SELECT_BTREE_NODE_INFO),
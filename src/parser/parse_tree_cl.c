@@ -14539,6 +14539,11 @@ pt_print_select (PARSER_CONTEXT * parser, PT_NODE * p)
 	      q = pt_append_nulstring (parser, q, "SAMPLING_SCAN ");
 	    }
 
+	  if (p->info.query.q.select.hint & PT_HINT_PARALLEL_SCAN)
+	    {
+	      q = pt_append_nulstring (parser, q, "PARALLEL_SCAN ");
+	    }
+
 	  if (p->info.query.q.select.hint & PT_HINT_SELECT_PAGE_INFO)
 	    {
 	      q = pt_append_nulstring (parser, q, "SELECT_PAGE_INFO ");
@@ -720,7 +720,9 @@ metadata_of_page_buffer_status (void)
     {"Pages_written_rate", "numeric(20,10)"},
     {"Num_pages_read", "bigint"},
     {"Pages_read_rate", "numeric(20,10)"},
-    {"Num_flusher_waiting_threads", "int"}
+    {"Num_flusher_waiting_threads", "int"},
+    {"Warmup_pages", "int"},
+    {"Warmup_loaded_pages", "int"}
   };
 
   static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
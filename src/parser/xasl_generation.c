@@ -17135,6 +17135,12 @@ pt_to_buildvalue_proc (PARSER_CONTEXT * parser, PT_NODE * select_node, QO_PLAN *
       XASL_SET_FLAG (xasl, XASL_SAMPLING_SCAN);
     }
 
+  /* check parallel scan */
+  if (select_node->info.query.q.select.hint & PT_HINT_PARALLEL_SCAN)
+    {
+      XASL_SET_FLAG (xasl, XASL_PARALLEL_SCAN);
+    }
+
   /* save info for derived table size estimation */
   xasl->projected_size = 1;
   xasl->cardinality = 1.0;
@@ -4387,6 +4387,7 @@ qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p)
 {
   PAGE_PTR page_p, next_page_p;
   VPID next_vpid;
+  bool is_bulk_read;
 
   if (scan_id_p->position == S_BEFORE)
     {
@@ -4423,7 +4424,17 @@ qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p)
       else if (qfile_has_next_page (scan_id_p->curr_pgptr))
 	{
 	  QFILE_GET_NEXT_VPID (&next_vpid, scan_id_p->curr_pgptr);
+	  pgbuf_read_ahead_notify (thread_p, &scan_id_p->read_ahead, &next_vpid);
+	  is_bulk_read = pgbuf_is_bulk_read_scan (&scan_id_p->read_ahead);
+	  if (is_bulk_read)
+	    {
+	      pgbuf_bulk_read_begin (thread_p);
+	    }
 	  next_page_p = qmgr_get_old_page (thread_p, &next_vpid, scan_id_p->list_id.tfile_vfid);
+	  if (is_bulk_read)
+	    {
+	      pgbuf_bulk_read_end (thread_p);
+	    }
 	  if (next_page_p == NULL)
 	    {
 	      return S_ERROR;
@@ -4747,6 +4758,7 @@ qfile_open_list_scan (QFILE_LIST_ID * list_id_p, QFILE_LIST_SCAN_ID * scan_id_p)
 
   scan_id_p->tplrec.size = 0;
   scan_id_p->tplrec.tpl = NULL;
+  pgbuf_read_ahead_init (&scan_id_p->read_ahead);
 
   return NO_ERROR;
 }
@@ -99,6 +99,10 @@ namespace cubquery
     aggregate_hash_value *curr_part_value;	/* current partial value */
     aggregate_hash_value *temp_part_value;	/* temporary partial value */
     int sorted_count;
+
+    /* spill partition stuff */
+    qfile_list_id **spill_list_ids;	/* tuples of groups that did not fit in hash table, NULL if none */
+    QFILE_TUPLE_RECORD spill_tuple;	/* tuple record used while spilling */
   };
 
 
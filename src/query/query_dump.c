@@ -2450,6 +2450,13 @@ qdump_print_xasl (xasl_node * xasl_p)
 	  nflag++;
 	}
 
+      if (XASL_IS_FLAGED (xasl_p, XASL_PARALLEL_SCAN))
+	{
+	  XASL_CLEAR_FLAG (xasl_p, XASL_PARALLEL_SCAN);
+	  fprintf (foutput, "%sXASL_PARALLEL_SCAN", (nflag ? "|" : ""));
+	  nflag++;
+	}
+
       if (xasl_p->flag)
 	{
 	  fprintf (foutput, "%d%s", xasl_p->flag, (nflag ? "|" : ""));
@@ -3130,6 +3137,10 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
 	json_object_set_new (build, "fetch_time", json_integer (hashjoin_proc->stats.build.fetch_time));
 	json_object_set_new (build, "ioread", json_integer (hashjoin_proc->stats.build.ioreads));
 	json_object_set_new (build, "hash_method", json_string (hash_method_string));
+	if (hashjoin_proc->stats.build.partitions > 0)
+	  {
+	    json_object_set_new (build, "partitions", json_integer (hashjoin_proc->stats.build.partitions));
+	  }
 
 #if defined(TEST_HASH_JOIN_PROFILE_TIME)
 	{
@@ -3268,6 +3279,16 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
 	  json_object_set_new (groupby, "hash", json_false ());
 	}
 
+      if (gstats->spill_partitions > 0)
+	{
+	  json_t *spill = json_object ();
+
+	  json_object_set_new (spill, "memory", json_integer (gstats->spill_memory));
+	  json_object_set_new (spill, "partitions", json_integer (gstats->spill_partitions));
+	  json_object_set_new (spill, "rows", json_integer (gstats->spill_rows));
+	  json_object_set_new (groupby, "spill", spill);
+	}
+
       if (gstats->groupby_sort)
 	{
 	  json_object_set_new (groupby, "sort", json_true ());
@@ -3540,6 +3561,11 @@ qdump_print_stats_text (FILE * fp, xasl_node * xasl_p, int indent)
 		 (long long int) hashjoin_proc->stats.build.fetch_time,
 		 (long long int) hashjoin_proc->stats.build.ioreads, hash_method_string);
 
+	if (hashjoin_proc->stats.build.partitions > 0)
+	  {
+	    fprintf (fp, ", partitions: %u", hashjoin_proc->stats.build.partitions);
+	  }
+
 #if defined(TEST_HASH_JOIN_PROFILE_TIME)
 	fprintf (fp,
 		 ", (F: %d, H: %d, I: %d)",
@@ -3650,6 +3676,12 @@ qdump_print_stats_text (FILE * fp, xasl_node * xasl_p, int indent)
 	  fprintf (fp, ", hash: false");
 	}
 
+      if (gstats->spill_partitions > 0)
+	{
+	  fprintf (fp, ", spill: (memory: %lld, partitions: %d, rows: %lld)", (long long int) gstats->spill_memory,
+		   gstats->spill_partitions, (long long int) gstats->spill_rows);
+	}
+
       if (gstats->groupby_sort)
 	{
 	  fprintf (fp, ", sort: true, page: %lld, ioread: %lld", (long long int) gstats->groupby_pages,
@@ -48,6 +48,43 @@
 
 #define UNKNOWN_CARD   -2	/* Unknown cardinality of a set member */
 
+/* limits of a compiled raw data filter; conjuncts beyond them are left to the predicate evaluator */
+#define RAW_FILTER_MAX_TERMS   16
+#define RAW_FILTER_MAX_VALUES  256
+
+typedef union raw_filter_value RAW_FILTER_VALUE;
+union raw_filter_value
+{
+  int i;			/* DB_TYPE_INTEGER */
+  DB_BIGINT bi;			/* DB_TYPE_BIGINT */
+  double d;			/* DB_TYPE_DOUBLE */
+  DB_DATE date;			/* DB_TYPE_DATE */
+  DB_DATETIME datetime;		/* DB_TYPE_DATETIME */
+};
+
+typedef struct raw_filter_term RAW_FILTER_TERM;
+struct raw_filter_term
+{
+  DB_TYPE type;			/* type of the attribute and of its constants */
+  REL_OP rel_op;		/* attribute rel_op constant; R_EQ matches any of the constants (IN) */
+  int position;			/* position of the attribute in the bound bit array */
+  int location;			/* offset of the attribute within the fixed area */
+  int first_value;		/* index of the first constant in raw_filter::values */
+  int num_values;		/* number of constants */
+};
+
+struct raw_filter
+{
+  REPR_ID repr_id;		/* representation the attributes were resolved against */
+  int n_variable;		/* number of variable attributes of the representation */
+  int fixed_length;		/* size of the fixed area of the representation */
+  bool covers_pred;		/* true if every conjunct of the predicate has been compiled */
+  int num_terms;
+  int num_values;
+  RAW_FILTER_TERM terms[RAW_FILTER_MAX_TERMS];
+  RAW_FILTER_VALUE values[RAW_FILTER_MAX_VALUES];
+};
+
 static DB_LOGICAL eval_negative (DB_LOGICAL res);
 static DB_LOGICAL eval_logical_result (DB_LOGICAL res1, DB_LOGICAL res2);
 static DB_LOGICAL eval_value_rel_cmp (THREAD_ENTRY * thread_p, DB_VALUE * dbval1, DB_VALUE * dbval2,
@@ -86,6 +123,16 @@ static DB_LOGICAL eval_sort_list_to_sort_list (THREAD_ENTRY * thread_p, QFILE_LI
 					       QFILE_LIST_ID * list_id2, REL_OP rel_operator);
 static DB_LOGICAL eval_set_list_cmp (THREAD_ENTRY * thread_p, const COMP_EVAL_TERM * et_comp, val_descr * vd,
 				     DB_VALUE * dbval1, DB_VALUE * dbval2);
+static bool eval_raw_filter_add_conjunct (const PRED_EXPR * pr, val_descr * vd, HEAP_CACHE_ATTRINFO * attr_info,
+					  RAW_FILTER * filter);
+static bool eval_raw_filter_resolve_attr (const REGU_VARIABLE * regu, HEAP_CACHE_ATTRINFO * attr_info,
+					  RAW_FILTER_TERM * term);
+static DB_VALUE *eval_raw_filter_peek_constant (REGU_VARIABLE * regu, val_descr * vd);
+static bool eval_raw_filter_set_value (DB_TYPE type, DB_VALUE * dbval, RAW_FILTER_VALUE * value);
+STATIC_INLINE void eval_raw_filter_read (DB_TYPE type, const char *disk_data, RAW_FILTER_VALUE * value)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int eval_raw_filter_cmp (DB_TYPE type, const RAW_FILTER_VALUE * value1,
+				       const RAW_FILTER_VALUE * value2) __attribute__ ((ALWAYS_INLINE));
 
 /*
  * eval_negative () - negate the result
@@ -3008,3 +3055,502 @@ eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, int prefix_size, DB_
 
   return ev_res;
 }
+
+/*
+ * Raw data filter
+ *
+ * Conjuncts of a heap scan data filter that compare a fixed width attribute (INTEGER, BIGINT, DOUBLE, DATE or
+ * DATETIME) with constants of the same type are compiled into typed terms. The terms read the attribute straight
+ * from the disk image of the record, so a record failing one of them is rejected before any attribute is decoded
+ * into the attribute cache and before the predicate tree is walked.
+ */
+
+/*
+ * eval_raw_filter_build () - compile the simple conjuncts of a data filter
+ *   return: error code
+ *   pr(in): data filter predicate
+ *   vd(in): value descriptor for positional values
+ *   attr_info(in): started attribute cache of the predicate attributes
+ *   filter(out): compiled filter, or NULL if no conjunct could be compiled
+ */
+int
+eval_raw_filter_build (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
+		       HEAP_CACHE_ATTRINFO * attr_info, RAW_FILTER ** filter)
+{
+  RAW_FILTER *raw_filter;
+  bool covers_pred = true;
+
+  *filter = NULL;
+
+  if (pr == NULL || attr_info == NULL || attr_info->last_classrepr == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  raw_filter = (RAW_FILTER *) db_private_alloc (thread_p, sizeof (RAW_FILTER));
+  if (raw_filter == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (RAW_FILTER));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  raw_filter->repr_id = attr_info->last_classrepr->id;
+  raw_filter->n_variable = attr_info->last_classrepr->n_variable;
+  raw_filter->fixed_length = attr_info->last_classrepr->fixed_length;
+  raw_filter->num_terms = 0;
+  raw_filter->num_values = 0;
+
+  /* walk the AND chain the same way eval_pred does, right hand side first */
+  while (pr->type == T_PRED && pr->pe.m_pred.bool_op == B_AND)
+    {
+      if (!eval_raw_filter_add_conjunct (pr->pe.m_pred.lhs, vd, attr_info, raw_filter))
+	{
+	  covers_pred = false;
+	}
+      pr = pr->pe.m_pred.rhs;
+    }
+  if (!eval_raw_filter_add_conjunct (pr, vd, attr_info, raw_filter))
+    {
+      covers_pred = false;
+    }
+
+  if (raw_filter->num_terms == 0)
+    {
+      db_private_free (thread_p, raw_filter);
+      return NO_ERROR;
+    }
+
+  raw_filter->covers_pred = covers_pred;
+  *filter = raw_filter;
+
+  return NO_ERROR;
+}
+
+/*
+ * eval_raw_filter_add_conjunct () - compile one conjunct of a data filter
+ *   return: true if the conjunct has been compiled
+ *   pr(in): conjunct
+ *   vd(in): value descriptor for positional values
+ *   attr_info(in): attribute cache of the predicate attributes
+ *   filter(in/out): filter being compiled
+ *
+ * Note: compiled are "attr rel_op constant" with rel_op one of =, <>, <, <=, >, >= (ranges and BETWEEN reach here as
+ *       pairs of those) and "attr IN (constant, ...)". A constant is either a literal or a host variable and must
+ *       have the type of the attribute, since the compiled term does no coercion.
+ */
+static bool
+eval_raw_filter_add_conjunct (const PRED_EXPR * pr, val_descr * vd, HEAP_CACHE_ATTRINFO * attr_info,
+			      RAW_FILTER * filter)
+{
+  const COMP_EVAL_TERM *et_comp;
+  const ALSM_EVAL_TERM *et_alsm;
+  REGU_VARIABLE *constant;
+  RAW_FILTER_TERM term;
+  DB_VALUE *dbval;
+  DB_VALUE elem_val;
+  DB_SET *set;
+  int i, size, num_values;
+  bool is_valid;
+
+  if (pr == NULL || pr->type != T_EVAL_TERM || filter->num_terms >= RAW_FILTER_MAX_TERMS)
+    {
+      return false;
+    }
+
+  switch (pr->pe.m_eval_term.et_type)
+    {
+    case T_COMP_EVAL_TERM:
+      et_comp = &pr->pe.m_eval_term.et.et_comp;
+      if (et_comp->lhs == NULL || et_comp->rhs == NULL)
+	{
+	  return false;
+	}
+
+      switch (et_comp->rel_op)
+	{
+	case R_EQ:
+	case R_NE:
+	case R_LT:
+	case R_LE:
+	case R_GT:
+	case R_GE:
+	  break;
+	default:
+	  return false;
+	}
+
+      term.rel_op = et_comp->rel_op;
+      if (eval_raw_filter_resolve_attr (et_comp->lhs, attr_info, &term))
+	{
+	  constant = et_comp->rhs;
+	}
+      else if (eval_raw_filter_resolve_attr (et_comp->rhs, attr_info, &term))
+	{
+	  /* constant rel_op attr, turn it around */
+	  constant = et_comp->lhs;
+	  term.rel_op = ((et_comp->rel_op == R_LT) ? R_GT : (et_comp->rel_op == R_LE) ? R_GE
+			 : (et_comp->rel_op == R_GT) ? R_LT : (et_comp->rel_op == R_GE) ? R_LE : et_comp->rel_op);
+	}
+      else
+	{
+	  return false;
+	}
+
+      dbval = eval_raw_filter_peek_constant (constant, vd);
+      if (dbval == NULL || filter->num_values >= RAW_FILTER_MAX_VALUES
+	  || !eval_raw_filter_set_value (term.type, dbval, &filter->values[filter->num_values]))
+	{
+	  return false;
+	}
+
+      term.first_value = filter->num_values;
+      term.num_values = 1;
+      break;
+
+    case T_ALSM_EVAL_TERM:
+      et_alsm = &pr->pe.m_eval_term.et.et_alsm;
+      if (et_alsm->eq_flag != F_SOME || et_alsm->rel_op != R_EQ || et_alsm->elem == NULL
+	  || et_alsm->elemset == NULL)
+	{
+	  return false;
+	}
+
+      term.rel_op = R_EQ;
+      if (!eval_raw_filter_resolve_attr (et_alsm->elem, attr_info, &term))
+	{
+	  return false;
+	}
+
+      dbval = eval_raw_filter_peek_constant (et_alsm->elemset, vd);
+      if (dbval == NULL || db_value_is_null (dbval) || !TP_IS_SET_TYPE (DB_VALUE_DOMAIN_TYPE (dbval)))
+	{
+	  return false;
+	}
+
+      set = db_get_set (dbval);
+      size = set_size (set);
+      if (size <= 0 || filter->num_values + size > RAW_FILTER_MAX_VALUES)
+	{
+	  /* an empty set is false for SOME regardless of the item; not worth a term */
+	  return false;
+	}
+
+      num_values = 0;
+      for (i = 0; i < size; i++)
+	{
+	  if (set_get_element (set, i, &elem_val) != NO_ERROR)
+	    {
+	      return false;
+	    }
+
+	  if (db_value_is_null (&elem_val))
+	    {
+	      /* a NULL member can only make the result unknown, which does not qualify either */
+	      continue;
+	    }
+
+	  is_valid = eval_raw_filter_set_value (term.type, &elem_val, &filter->values[filter->num_values + num_values]);
+	  pr_clear_value (&elem_val);
+	  if (!is_valid)
+	    {
+	      return false;
+	    }
+	  num_values++;
+	}
+
+      term.first_value = filter->num_values;
+      term.num_values = num_values;
+      break;
+
+    default:
+      return false;
+    }
+
+  filter->num_values += term.num_values;
+  filter->terms[filter->num_terms++] = term;
+
+  return true;
+}
+
+/*
+ * eval_raw_filter_resolve_attr () - locate a fixed width attribute of the scanned class
+ *   return: true if the regu variable is an attribute the raw filter can read
+ *   regu(in): regu variable
+ *   attr_info(in): attribute cache of the predicate attributes
+ *   term(out): type and location of the attribute
+ */
+static bool
+eval_raw_filter_resolve_attr (const REGU_VARIABLE * regu, HEAP_CACHE_ATTRINFO * attr_info, RAW_FILTER_TERM * term)
+{
+  HEAP_ATTRVALUE *attrvalue;
+  OR_ATTRIBUTE *attrepr;
+
+  if (regu->type != TYPE_ATTR_ID || regu->xasl != NULL || regu->value.attr_descr.cache_attrinfo != attr_info)
+    {
+      return false;
+    }
+
+  attrvalue = heap_attrvalue_locate (regu->value.attr_descr.id, attr_info);
+  if (attrvalue == NULL || attrvalue->attr_type != HEAP_INSTANCE_ATTR)
+    {
+      return false;
+    }
+
+  attrepr = attrvalue->last_attrepr;
+  if (attrepr == NULL || !attrepr->is_fixed)
+    {
+      return false;
+    }
+
+  switch (attrepr->type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_DATETIME:
+      break;
+    default:
+      return false;
+    }
+
+  term->type = attrepr->type;
+  term->position = attrepr->position;
+  term->location = attrepr->location;
+
+  return true;
+}
+
+/*
+ * eval_raw_filter_peek_constant () - peek the value of a regu variable that stays the same for the whole scan
+ *   return: value, or NULL if the regu variable is not a literal or a host variable
+ *   regu(in): regu variable
+ *   vd(in): value descriptor for positional values
+ */
+static DB_VALUE *
+eval_raw_filter_peek_constant (REGU_VARIABLE * regu, val_descr * vd)
+{
+  if (regu->xasl != NULL)
+    {
+      return NULL;
+    }
+
+  if (regu->type == TYPE_DBVAL)
+    {
+      return &regu->value.dbval;
+    }
+
+  if (regu->type == TYPE_POS_VALUE && vd != NULL && regu->value.val_pos >= 0 && regu->value.val_pos < vd->dbval_cnt)
+    {
+      return (DB_VALUE *) vd->dbval_ptr + regu->value.val_pos;
+    }
+
+  return NULL;
+}
+
+/*
+ * eval_raw_filter_set_value () - store a constant of a raw filter term
+ *   return: true if the constant is not NULL and has the type of the attribute
+ *   type(in): attribute type
+ *   dbval(in): constant
+ *   value(out): native value
+ */
+static bool
+eval_raw_filter_set_value (DB_TYPE type, DB_VALUE * dbval, RAW_FILTER_VALUE * value)
+{
+  if (db_value_is_null (dbval) || DB_VALUE_DOMAIN_TYPE (dbval) != type)
+    {
+      return false;
+    }
+
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      value->i = db_get_int (dbval);
+      break;
+    case DB_TYPE_BIGINT:
+      value->bi = db_get_bigint (dbval);
+      break;
+    case DB_TYPE_DOUBLE:
+      value->d = db_get_double (dbval);
+      break;
+    case DB_TYPE_DATE:
+      value->date = *db_get_date (dbval);
+      break;
+    case DB_TYPE_DATETIME:
+      value->datetime = *db_get_datetime (dbval);
+      break;
+    default:
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * eval_raw_filter_read () - read a fixed width attribute from the disk image of a record
+ *   type(in): attribute type
+ *   disk_data(in): attribute within the fixed area
+ *   value(out): native value
+ */
+STATIC_INLINE void
+eval_raw_filter_read (DB_TYPE type, const char *disk_data, RAW_FILTER_VALUE * value)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      value->i = OR_GET_INT (disk_data);
+      break;
+    case DB_TYPE_BIGINT:
+      OR_GET_BIGINT (disk_data, &value->bi);
+      break;
+    case DB_TYPE_DOUBLE:
+      OR_GET_DOUBLE (disk_data, &value->d);
+      break;
+    case DB_TYPE_DATE:
+      OR_GET_DATE (disk_data, &value->date);
+      break;
+    case DB_TYPE_DATETIME:
+      OR_GET_DATETIME (disk_data, &value->datetime);
+      break;
+    default:
+      assert (false);
+      break;
+    }
+}
+
+/*
+ * eval_raw_filter_cmp () - compare two native values of a raw filter term
+ *   return: negative, zero or positive like the tp_*_compare functions
+ *   type(in): type of both values
+ *   value1(in): attribute value
+ *   value2(in): constant
+ */
+STATIC_INLINE int
+eval_raw_filter_cmp (DB_TYPE type, const RAW_FILTER_VALUE * value1, const RAW_FILTER_VALUE * value2)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      return (value1->i < value2->i) ? -1 : (value1->i > value2->i);
+    case DB_TYPE_BIGINT:
+      return (value1->bi < value2->bi) ? -1 : (value1->bi > value2->bi);
+    case DB_TYPE_DOUBLE:
+      return (value1->d < value2->d) ? -1 : (value1->d > value2->d);
+    case DB_TYPE_DATE:
+      return (value1->date < value2->date) ? -1 : (value1->date > value2->date);
+    case DB_TYPE_DATETIME:
+      if (value1->datetime.date != value2->datetime.date)
+	{
+	  return (value1->datetime.date < value2->datetime.date) ? -1 : 1;
+	}
+      return (value1->datetime.time < value2->datetime.time) ? -1 : (value1->datetime.time > value2->datetime.time);
+    default:
+      assert (false);
+      return 0;
+    }
+}
+
+/*
+ * eval_raw_filter () - evaluate the compiled conjuncts on a heap record
+ *   return: V_TRUE if all compiled conjuncts hold, V_FALSE if one of them is false or unknown, V_UNKNOWN if the
+ *	     record cannot be judged here because it was written with another representation
+ *   filter(in): compiled filter
+ *   recdes(in): record
+ */
+DB_LOGICAL
+eval_raw_filter (const RAW_FILTER * filter, RECDES * recdes)
+{
+  const RAW_FILTER_TERM *term;
+  const RAW_FILTER_VALUE *values;
+  RAW_FILTER_VALUE attr_value;
+  char *fixed_area;
+  int i, j, cmp;
+  bool match;
+
+  if (recdes->data == NULL || or_rep_id (recdes) != filter->repr_id)
+    {
+      return V_UNKNOWN;
+    }
+
+  fixed_area = recdes->data + OR_FIXED_ATTRIBUTES_OFFSET_BY_OBJ (recdes->data, filter->n_variable);
+
+  for (i = 0, term = filter->terms; i < filter->num_terms; i++, term++)
+    {
+      if (OR_FIXED_ATT_IS_UNBOUND (recdes->data, filter->n_variable, filter->fixed_length, term->position))
+	{
+	  /* NULL compares unknown */
+	  return V_FALSE;
+	}
+
+      eval_raw_filter_read (term->type, fixed_area + term->location, &attr_value);
+      values = &filter->values[term->first_value];
+
+      if (term->rel_op == R_EQ)
+	{
+	  match = false;
+	  for (j = 0; j < term->num_values; j++)
+	    {
+	      if (eval_raw_filter_cmp (term->type, &attr_value, &values[j]) == 0)
+		{
+		  match = true;
+		  break;
+		}
+	    }
+	}
+      else
+	{
+	  assert (term->num_values == 1);
+	  cmp = eval_raw_filter_cmp (term->type, &attr_value, &values[0]);
+	  switch (term->rel_op)
+	    {
+	    case R_NE:
+	      match = (cmp != 0);
+	      break;
+	    case R_LT:
+	      match = (cmp < 0);
+	      break;
+	    case R_LE:
+	      match = (cmp <= 0);
+	      break;
+	    case R_GT:
+	      match = (cmp > 0);
+	      break;
+	    case R_GE:
+	      match = (cmp >= 0);
+	      break;
+	    default:
+	      assert (false);
+	      return V_UNKNOWN;
+	    }
+	}
+
+      if (!match)
+	{
+	  return V_FALSE;
+	}
+    }
+
+  return V_TRUE;
+}
+
+/*
+ * eval_raw_filter_covers_pred () - tell whether the compiled filter is the whole data filter
+ *   return: true if every conjunct has been compiled, so V_TRUE from eval_raw_filter qualifies the record
+ *   filter(in): compiled filter
+ */
+bool
+eval_raw_filter_covers_pred (const RAW_FILTER * filter)
+{
+  return filter->covers_pred;
+}
+
+/*
+ * eval_raw_filter_free () - free a compiled filter
+ *   filter(in): compiled filter
+ */
+void
+eval_raw_filter_free (THREAD_ENTRY * thread_p, RAW_FILTER * filter)
+{
+  db_private_free (thread_p, filter);
+}
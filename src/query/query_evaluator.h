@@ -107,6 +107,9 @@ struct scan_attrs
   int num_attrs;		/* number of attributes */
 };
 
+/* conjuncts of a data filter compiled for evaluation on the disk image of a heap record */
+typedef struct raw_filter RAW_FILTER;
+
 /* informations that are need for applying filter (predicate) */
 typedef struct filter_info FILTER_INFO;
 struct filter_info
@@ -151,5 +154,10 @@ extern DB_LOGICAL eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES *
 extern DB_LOGICAL eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, int prefix_size, DB_VALUE * prefix_value,
 				   FILTER_INFO * filter);
 extern DB_LOGICAL update_logical_result (THREAD_ENTRY * thread_p, DB_LOGICAL ev_res, int *qualification);
+extern int eval_raw_filter_build (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
+				  HEAP_CACHE_ATTRINFO * attr_info, RAW_FILTER ** filter);
+extern DB_LOGICAL eval_raw_filter (const RAW_FILTER * filter, RECDES * recdes);
+extern bool eval_raw_filter_covers_pred (const RAW_FILTER * filter);
+extern void eval_raw_filter_free (THREAD_ENTRY * thread_p, RAW_FILTER * filter);
 
 #endif /* _QUERY_EVALUATOR_H_ */
@@ -130,6 +130,19 @@ struct xasl_state
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* number of partitions the groups overflowing the hash table are spilled to */
+#define HASH_AGGREGATE_SPILL_PARTITION_CNT 32
+
+/* a partition spilled again at this depth is aggregated in memory regardless of max_agg_hash_size */
+#define HASH_AGGREGATE_SPILL_MAX_LEVEL 3
+
+/* partition fanout bounds of a hash join whose build input exceeds max_hash_list_scan_size */
+#define HASHJOIN_PARTITION_MIN_CNT 2
+#define HASHJOIN_PARTITION_MAX_CNT 64
+
+/* a partition still too large at this depth is joined by the hybrid or file hash method */
+#define HASHJOIN_PARTITION_MAX_LEVEL 3
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -468,6 +481,11 @@ static int qexec_gby_finalize_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE
 static void qexec_gby_finalize_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N, bool keep_list_file);
 static SORT_STATUS qexec_hash_gby_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_hash_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
+static int qexec_hash_gby_open_spill (THREAD_ENTRY * thread_p, QFILE_TUPLE_VALUE_TYPE_LIST * type_list,
+				      QUERY_ID query_id, QFILE_LIST_ID ** spill_list_ids);
+static int qexec_hash_gby_output_htable (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, MHT_TABLE * hash_table);
+static int qexec_hash_gby_agg_spilled (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, BUILDLIST_PROC_NODE * proc,
+				       QFILE_LIST_ID ** spill_list_ids, int level);
 static SORT_STATUS qexec_gby_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
 static int qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
@@ -538,6 +556,16 @@ static void qexec_hash_join_scan_clear (THREAD_ENTRY * thread_p, HASH_LIST_SCAN
 static int qexec_hash_join (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				     HASHJOIN_PROC_NODE * hashjoin_proc, QFILE_LIST_ID * list_id);
+static int qexec_hash_join_build_and_probe (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_proc,
+					    QFILE_LIST_ID * build_list_id, QFILE_LIST_ID * probe_list_id,
+					    QFILE_LIST_ID * list_id);
+static bool qexec_hash_join_need_partition (HASHJOIN_PROC_NODE * hashjoin_proc, QFILE_LIST_ID * build_list_id);
+static int qexec_hash_join_partitioned (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_proc,
+					QFILE_LIST_ID * build_list_id, QFILE_LIST_ID * probe_list_id, int level,
+					QFILE_LIST_ID * list_id);
+static int qexec_hash_join_partition (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_proc,
+				      HASHJOIN_INPUT * input, QFILE_LIST_ID * list_id, int level, int partition_cnt,
+				      QFILE_LIST_ID ** part_list_ids);
 static int qexec_hash_outer_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 					   HASHJOIN_PROC_NODE * hashjoin_proc, QFILE_LIST_ID * list_id);
 static int qexec_hash_outer_join_fill_outer (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
@@ -564,6 +592,10 @@ STATIC_INLINE int qexec_hash_join_probe_key (THREAD_ENTRY * thread_p, HASH_LIST_
 
 /* End: Hash Join Functions */
 
+STATIC_INLINE int qexec_hash_partition_index (unsigned int hash_key, int level, int partition_cnt)
+  __attribute__ ((ALWAYS_INLINE));
+static void qexec_destroy_partition_lists (THREAD_ENTRY * thread_p, QFILE_LIST_ID ** part_list_ids, int partition_cnt);
+
 static int qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
 			    bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
 			    QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
@@ -722,6 +754,7 @@ static int qexec_init_agg_hierarchy_helpers (THREAD_ENTRY * thread_p, ACCESS_SPE
 					     int *helpers_countp);
 static int qexec_evaluate_aggregates_optimize (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * agg_list,
 					       ACCESS_SPEC_TYPE * spec, bool * is_scan_needed);
+static int qexec_evaluate_count_star_parallel (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool * is_counted);
 static int qexec_evaluate_partition_aggregates (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec,
 						AGGREGATE_TYPE * agg_list, bool * is_scan_needed);
 
@@ -3835,7 +3868,40 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 
   /* probe hash table */
   value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
-  if (value == NULL)
+  if (value == NULL && context->spill_list_ids != NULL)
+    {
+      int tuple_size = tpldesc->tpl_size;
+      int part_index;
+
+      /* hash table is full; the group is aggregated from its spill partition after the scan */
+      if (context->spill_tuple.size < tuple_size
+	  && qfile_reallocate_tuple (&context->spill_tuple, tuple_size) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      if (qfile_save_tuple (tpldesc, T_NORMAL, context->spill_tuple.tpl, &tuple_size) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      part_index = qexec_hash_partition_index (qdata_hash_agg_hkey (key, UINT_MAX), 0,
+					       HASH_AGGREGATE_SPILL_PARTITION_CNT);
+      rc = qfile_add_tuple_to_list (thread_p, context->spill_list_ids[part_index], context->spill_tuple.tpl);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      /* no need to output tuple */
+      *output_tuple = false;
+
+      if (thread_is_on_trace (thread_p))
+	{
+	  xasl->groupby_stats.spill_rows++;
+	}
+    }
+  else if (value == NULL)
     {
       AGGREGATE_HASH_KEY *new_key;
       AGGREGATE_HASH_VALUE *new_value;
@@ -3925,8 +3991,42 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	}
     }
 
+  /* spill groups that do not fit in the hash table to partitions, unless sort-based aggregation still needs the first
+   * tuples of the groups or the output has to follow the order of the groups */
+  if (context->hash_size > (int) mem_limit && context->spill_list_ids == NULL && !proc->g_output_first_tuple
+      && !prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER))
+    {
+      context->spill_list_ids =
+	(QFILE_LIST_ID **) db_private_alloc (thread_p, sizeof (QFILE_LIST_ID *) * HASH_AGGREGATE_SPILL_PARTITION_CNT);
+      if (context->spill_list_ids == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  sizeof (QFILE_LIST_ID *) * HASH_AGGREGATE_SPILL_PARTITION_CNT);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+
+      rc = qexec_hash_gby_open_spill (thread_p, &groupby_list->type_list, xasl_state->query_id,
+				      context->spill_list_ids);
+      if (rc != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, context->spill_list_ids);
+	  return rc;
+	}
+
+      if (thread_is_on_trace (thread_p))
+	{
+	  xasl->groupby_stats.spill_memory = mem_limit;
+	  xasl->groupby_stats.spill_partitions += HASH_AGGREGATE_SPILL_PARTITION_CNT;
+	}
+
+#if !defined(NDEBUG)
+      er_log_debug (ARG_FILE_LINE, "hash aggregation overflow: spilling new groups to %d partitions",
+		    HASH_AGGREGATE_SPILL_PARTITION_CNT);
+#endif
+    }
+
   /* keep hash table within memory limit */
-  while (context->hash_size > (int) mem_limit)
+  while (context->spill_list_ids == NULL && context->hash_size > (int) mem_limit)
     {
       /* get least recently used entry */
       hentry = context->hash_table->lru_head;
@@ -3966,8 +4066,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       mht_rem (context->hash_table, key, qdata_free_agg_hentry, NULL);
     }
 
-  /* check very high selectivity case */
-  if (context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
+  /* check very high selectivity case; spilled groups are not counted, so leave a spilling table alone */
+  if (context->spill_list_ids == NULL && context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
     {
       float selectivity = (float) context->group_count / context->tuple_count;
       if (selectivity > HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD)
@@ -4161,6 +4261,292 @@ qexec_hash_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *a
   return NO_ERROR;
 }
 
+/*
+ * qexec_hash_gby_open_spill () - open the spill partitions of a hash aggregation
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   type_list(in): type list of the tuples to spill
+ *   query_id(in): query id
+ *   spill_list_ids(out): HASH_AGGREGATE_SPILL_PARTITION_CNT opened list files
+ */
+static int
+qexec_hash_gby_open_spill (THREAD_ENTRY * thread_p, QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QUERY_ID query_id,
+			   QFILE_LIST_ID ** spill_list_ids)
+{
+  int part_index;
+
+  for (part_index = 0; part_index < HASH_AGGREGATE_SPILL_PARTITION_CNT; part_index++)
+    {
+      spill_list_ids[part_index] = NULL;
+    }
+
+  for (part_index = 0; part_index < HASH_AGGREGATE_SPILL_PARTITION_CNT; part_index++)
+    {
+      spill_list_ids[part_index] = qfile_open_list (thread_p, type_list, NULL, query_id, QFILE_FLAG_ALL, NULL);
+      if (spill_list_ids[part_index] == NULL)
+	{
+	  qexec_destroy_partition_lists (thread_p, spill_list_ids, HASH_AGGREGATE_SPILL_PARTITION_CNT);
+
+	  return (er_errid () != NO_ERROR) ? er_errid () : ER_FAILED;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_output_htable () - output the groups of a hash table
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   hash_table(in): hash table of groups whose first tuple is kept in the entry
+ *
+ * Note: accumulators are moved to the output aggregate list, so the entries may only be freed afterwards.
+ */
+static int
+qexec_hash_gby_output_htable (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, MHT_TABLE * hash_table)
+{
+  HENTRY_PTR head = hash_table->act_head;
+  AGGREGATE_HASH_VALUE *value = NULL;
+
+  while (head && gbstate->state == NO_ERROR)
+    {
+      /* load entry into aggregate list */
+      value = (AGGREGATE_HASH_VALUE *) head->data;
+      if (value == NULL)
+	{
+	  /* should not happen */
+	  return ER_FAILED;
+	}
+
+      if (value->first_tuple.tpl == NULL)
+	{
+	  /* empty unsorted list and no first tuple? this should not happen ... */
+	  return ER_FAILED;
+	}
+
+      /* start new group and aggregate tuple; since unsorted list is empty we don't have rollup groups */
+      qexec_gby_start_group_dim (thread_p, gbstate, NULL);
+
+      /* load values in list and aggregate first tuple */
+      qdata_load_agg_hvalue_in_agg_list (value, gbstate->g_dim[0].d_agg_list, false);
+      qexec_gby_agg_tuple (thread_p, gbstate, value->first_tuple.tpl, PEEK);
+
+      /* finalize */
+      qexec_gby_finalize_group_dim (thread_p, gbstate, NULL);
+
+      /* next entry */
+      head = head->act_next;
+      gbstate->input_recs += value->tuple_count + 1;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_agg_spilled () - aggregate spilled groups, one partition at a time
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   proc(in): BUILDLIST proc node
+ *   spill_list_ids(in): HASH_AGGREGATE_SPILL_PARTITION_CNT partitions, destroyed as they are aggregated
+ *   level(in): recursion level the partitions were spilled at
+ *
+ * Note: a group lives in a single partition, so the hash table is emptied between partitions. The groups of a
+ *       partition that do not fit in the hash table either are spilled again to sub-partitions by other hash bits.
+ */
+static int
+qexec_hash_gby_agg_spilled (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, BUILDLIST_PROC_NODE * proc,
+			    QFILE_LIST_ID ** spill_list_ids, int level)
+{
+  AGGREGATE_HASH_CONTEXT *context = proc->agg_hash_context;
+  AGGREGATE_HASH_KEY *key = context->temp_key;
+  AGGREGATE_HASH_VALUE *value;
+  QFILE_LIST_ID *sub_list_ids[HASH_AGGREGATE_SPILL_PARTITION_CNT];
+  bool has_sub_list_ids = false;
+  QFILE_LIST_SCAN_ID spill_scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  SCAN_CODE qp_scan;
+  XASL_STATE *xasl_state = gbstate->xasl_state;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  bool on_trace = thread_is_on_trace (thread_p);
+  int part_index, sub_index;
+  int rc = NO_ERROR;
+
+  spill_scan_id.status = S_CLOSED;
+
+  for (part_index = 0; part_index < HASH_AGGREGATE_SPILL_PARTITION_CNT && gbstate->state == NO_ERROR; part_index++)
+    {
+      if (spill_list_ids[part_index] == NULL)
+	{
+	  continue;
+	}
+
+      qfile_close_list (thread_p, spill_list_ids[part_index]);
+
+      if (spill_list_ids[part_index]->tuple_cnt == 0)
+	{
+	  qexec_destroy_partition_lists (thread_p, &spill_list_ids[part_index], 1);
+	  continue;
+	}
+
+      /* start from an empty hash table */
+      (void) mht_clear (context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
+      context->hash_size = 0;
+
+      rc = qfile_open_list_scan (spill_list_ids[part_index], &spill_scan_id);
+      if (rc != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      while ((qp_scan = qfile_scan_list_next (thread_p, &spill_scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+	{
+	  rc = qexec_build_agg_hkey (thread_p, xasl_state, proc->g_hk_sort_regu_list, tuple_record.tpl, key);
+	  if (rc != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+
+	  value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
+	  if (value == NULL && context->hash_size > (int) mem_limit && level + 1 < HASH_AGGREGATE_SPILL_MAX_LEVEL)
+	    {
+	      /* spill again */
+	      if (!has_sub_list_ids)
+		{
+		  rc = qexec_hash_gby_open_spill (thread_p, &spill_list_ids[part_index]->type_list,
+						  xasl_state->query_id, sub_list_ids);
+		  if (rc != NO_ERROR)
+		    {
+		      goto exit_on_error;
+		    }
+		  has_sub_list_ids = true;
+
+		  if (on_trace)
+		    {
+		      gbstate->xasl->groupby_stats.spill_partitions += HASH_AGGREGATE_SPILL_PARTITION_CNT;
+		    }
+		}
+
+	      sub_index = qexec_hash_partition_index (qdata_hash_agg_hkey (key, UINT_MAX), level + 1,
+						      HASH_AGGREGATE_SPILL_PARTITION_CNT);
+	      rc = qfile_add_tuple_to_list (thread_p, sub_list_ids[sub_index], tuple_record.tpl);
+	      if (rc != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+
+	      if (on_trace)
+		{
+		  gbstate->xasl->groupby_stats.spill_rows++;
+		}
+	    }
+	  else if (value == NULL)
+	    {
+	      AGGREGATE_HASH_KEY *new_key;
+	      AGGREGATE_HASH_VALUE *new_value;
+	      int tuple_size = QFILE_GET_TUPLE_LENGTH (tuple_record.tpl);
+
+	      /* new group; keep its tuple as the first tuple, like qexec_hash_gby_agg_tuple does */
+	      new_key = qdata_copy_agg_hkey (thread_p, key);
+	      if (new_key == NULL)
+		{
+		  goto exit_on_error;
+		}
+
+	      new_value = qdata_alloc_agg_hvalue (thread_p, proc->g_func_count, proc->g_agg_list);
+	      if (new_value == NULL)
+		{
+		  qdata_free_agg_hkey (thread_p, new_key);
+		  goto exit_on_error;
+		}
+
+	      new_value->first_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, tuple_size);
+	      if (new_value->first_tuple.tpl == NULL)
+		{
+		  qdata_free_agg_hkey (thread_p, new_key);
+		  qdata_free_agg_hvalue (thread_p, new_value);
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) tuple_size);
+		  goto exit_on_error;
+		}
+	      new_value->first_tuple.size = tuple_size;
+	      memcpy (new_value->first_tuple.tpl, tuple_record.tpl, tuple_size);
+
+	      mht_put (context->hash_table, (void *) new_key, (void *) new_value);
+
+	      context->hash_size += qdata_get_agg_hkey_size (new_key);
+	      context->hash_size += qdata_get_agg_hvalue_size (new_value, false);
+	    }
+	  else
+	    {
+	      value->tuple_count++;
+
+	      /* fetch values from the tuple, as sort-based aggregation does, and aggregate them */
+	      rc = fetch_val_list (thread_p, proc->g_regu_list, &xasl_state->vd, NULL, NULL, tuple_record.tpl, PEEK);
+	      if (rc == NO_ERROR)
+		{
+		  rc = qdata_evaluate_aggregate_list (thread_p, proc->g_agg_list, &xasl_state->vd, value->accumulators);
+		}
+
+	      context->hash_size += qdata_get_agg_hvalue_size (value, true);
+
+	      if (rc != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+	    }
+	}
+
+      if (qp_scan == S_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* partition is no longer necessary */
+      qfile_close_scan (thread_p, &spill_scan_id);
+      qexec_destroy_partition_lists (thread_p, &spill_list_ids[part_index], 1);
+
+      rc = qexec_hash_gby_output_htable (thread_p, gbstate, context->hash_table);
+      if (rc != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      if (has_sub_list_ids)
+	{
+	  rc = qexec_hash_gby_agg_spilled (thread_p, gbstate, proc, sub_list_ids, level + 1);
+	  if (rc != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+
+	  has_sub_list_ids = false;
+	}
+    }
+
+  return NO_ERROR;
+
+exit_on_error:
+  qfile_close_scan (thread_p, &spill_scan_id);
+
+  if (has_sub_list_ids)
+    {
+      qexec_destroy_partition_lists (thread_p, sub_list_ids, HASH_AGGREGATE_SPILL_PARTITION_CNT);
+    }
+
+  if (rc == NO_ERROR)
+    {
+      assert (er_errid () != NO_ERROR);
+      rc = er_errid ();
+      if (rc == NO_ERROR)
+	{
+	  rc = ER_FAILED;
+	}
+    }
+
+  return rc;
+}
+
 /*
  * qexec_gby_get_next () -
  *   return:
@@ -4593,39 +4979,20 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       else if (gbstate.agg_hash_context->part_list_id->tuple_cnt == 0
 	       && !prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER))
 	{
-	  HENTRY_PTR head = gbstate.agg_hash_context->hash_table->act_head;
-	  AGGREGATE_HASH_VALUE *value = NULL;
-
 	  /* empty unsorted list and empty partial list; we can generate the output from the hash table */
-	  while (head)
+	  if (qexec_hash_gby_output_htable (thread_p, &gbstate, gbstate.agg_hash_context->hash_table) != NO_ERROR)
 	    {
-	      /* load entry into aggregate list */
-	      value = (AGGREGATE_HASH_VALUE *) head->data;
-	      if (value == NULL)
-		{
-		  /* should not happen */
-		  GOTO_EXIT_ON_ERROR;
-		}
+	      GOTO_EXIT_ON_ERROR;
+	    }
 
-	      if (value->first_tuple.tpl == NULL)
+	  /* then from the groups spilled out of it */
+	  if (gbstate.agg_hash_context->spill_list_ids != NULL && gbstate.state == NO_ERROR)
+	    {
+	      if (qexec_hash_gby_agg_spilled (thread_p, &gbstate, buildlist, gbstate.agg_hash_context->spill_list_ids,
+					      0) != NO_ERROR)
 		{
-		  /* empty unsorted list and no first tuple? this should not happen ... */
 		  GOTO_EXIT_ON_ERROR;
 		}
-
-	      /* start new group and aggregate tuple; since unsorted list is empty we don't have rollup groups */
-	      qexec_gby_start_group_dim (thread_p, &gbstate, NULL);
-
-	      /* load values in list and aggregate first tuple */
-	      qdata_load_agg_hvalue_in_agg_list (value, gbstate.g_dim[0].d_agg_list, false);
-	      qexec_gby_agg_tuple (thread_p, &gbstate, value->first_tuple.tpl, PEEK);
-
-	      /* finalize */
-	      qexec_gby_finalize_group_dim (thread_p, &gbstate, NULL);
-
-	      /* next entry */
-	      head = head->act_next;
-	      gbstate.input_recs += value->tuple_count + 1;
 	    }
 
 	  /* output generated; finalize */
@@ -4644,6 +5011,51 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       old_sort_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_SORT_NUM_IO_PAGES);
     }
 
+  /* unsorted list is not empty; return spilled tuples to it for sort-based aggregation */
+  if (gbstate.hash_eligible && gbstate.agg_hash_context->spill_list_ids != NULL)
+    {
+      QFILE_LIST_ID **spill_list_ids = gbstate.agg_hash_context->spill_list_ids;
+      QFILE_LIST_SCAN_ID spill_scan_id;
+      QFILE_TUPLE_RECORD spill_tuple = { NULL, 0 };
+      SCAN_CODE spill_scan_code;
+      int part_index;
+
+      if (qfile_reopen_list_as_append_mode (thread_p, list_id) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      for (part_index = 0; part_index < HASH_AGGREGATE_SPILL_PARTITION_CNT; part_index++)
+	{
+	  qfile_close_list (thread_p, spill_list_ids[part_index]);
+
+	  if (qfile_open_list_scan (spill_list_ids[part_index], &spill_scan_id) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  while ((spill_scan_code = qfile_scan_list_next (thread_p, &spill_scan_id, &spill_tuple, PEEK)) == S_SUCCESS)
+	    {
+	      if (qfile_add_tuple_to_list (thread_p, list_id, spill_tuple.tpl) != NO_ERROR)
+		{
+		  spill_scan_code = S_ERROR;
+		  break;
+		}
+	    }
+
+	  qfile_close_scan (thread_p, &spill_scan_id);
+
+	  if (spill_scan_code == S_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  qexec_destroy_partition_lists (thread_p, &spill_list_ids[part_index], 1);
+	}
+
+      qfile_close_list (thread_p, list_id);
+    }
+
   /* unsorted list is not empty; dump hash table to partial list */
   if (gbstate.hash_eligible && gbstate.agg_hash_context->tuple_count > 0
       && mht_count (gbstate.agg_hash_context->hash_table) > 0)
@@ -6794,11 +7206,34 @@ qexec_hash_join_init (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_pro
   /*
    * hash_scan
    */
-  error =
-    qexec_hash_join_scan_init (thread_p, &(hashjoin_proc->hash_scan), hashjoin_proc->build->xasl->list_id, value_count);
-  if (error != NO_ERROR)
+  if (qexec_hash_join_need_partition (hashjoin_proc, hashjoin_proc->build->xasl->list_id) == true)
     {
-      goto exit_on_error;
+      /* The inputs are partitioned by the key first, and each pair of partitions sets up its own hash table.
+       * Only the keys are needed until then. */
+      hashjoin_proc->hash_scan.temp_key = qdata_alloc_hscan_key (thread_p, value_count, true);
+      if (hashjoin_proc->hash_scan.temp_key == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      hashjoin_proc->hash_scan.temp_new_key = qdata_alloc_hscan_key (thread_p, value_count, true);
+      if (hashjoin_proc->hash_scan.temp_new_key == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      hashjoin_proc->hash_scan.hash_list_scan_type = HASH_METH_NOT_USE;
+      hashjoin_proc->hash_scan.curr_hash_key = 0;
+    }
+  else
+    {
+      error =
+	qexec_hash_join_scan_init (thread_p, &(hashjoin_proc->hash_scan), hashjoin_proc->build->xasl->list_id,
+				   value_count);
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
     }
 
   hashjoin_proc->hash_scan.need_coerce_type = need_coerce_domains;
@@ -6995,7 +7430,7 @@ qexec_hash_join_scan_clear (THREAD_ENTRY * thread_p, HASH_LIST_SCAN * hash_scan)
 	    hash_scan->memory.hash_table = NULL;
 	  }
 
-	hash_scan->hash_list_scan_type == HASH_METH_NOT_USE;
+	hash_scan->hash_list_scan_type = HASH_METH_NOT_USE;
 
 	break;
       }
@@ -7008,7 +7443,7 @@ qexec_hash_join_scan_clear (THREAD_ENTRY * thread_p, HASH_LIST_SCAN * hash_scan)
 	    db_private_free_and_init (thread_p, hash_scan->file.hash_table);
 	  }
 
-	hash_scan->hash_list_scan_type == HASH_METH_NOT_USE;
+	hash_scan->hash_list_scan_type = HASH_METH_NOT_USE;
 
 	break;
       }
@@ -7234,14 +7669,10 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 {
   XASL_NODE *build_xasl, *probe_xasl;
   QFILE_LIST_ID *build_list_id, *probe_list_id;
-  QFILE_LIST_SCAN_ID build_list_scan_id, probe_list_scan_id;
 
   HASHJOIN_STATS *stats;
 
   bool on_trace = thread_is_on_trace (thread_p);
-  TSC_TICKS start_tick, end_tick;
-  TSCTIMEVAL tv_diff;
-  UINT64 old_fetches = 0, old_ioreads = 0, old_fetch_time = 0;
 
   int error = NO_ERROR;
 
@@ -7267,6 +7698,71 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   assert (build_list_id != NULL);
   assert (probe_list_id != NULL);
 
+  if (on_trace)
+    {
+      stats = &(hashjoin_proc->stats);
+      stats->hash_method = hashjoin_proc->hash_scan.hash_list_scan_type;
+
+      TSC_ADD_TIMEVAL (stats->build.elapsed_time, build_xasl->xasl_stats.elapsed_time);
+      TSC_ADD_TIMEVAL (stats->probe.elapsed_time, probe_xasl->xasl_stats.elapsed_time);
+    }
+
+  if (hashjoin_proc->hash_scan.hash_list_scan_type == HASH_METH_NOT_USE)
+    {
+      /* The build input does not fit in memory. See qexec_hash_join_init. */
+      error = qexec_hash_join_partitioned (thread_p, hashjoin_proc, build_list_id, probe_list_id, 0, list_id);
+    }
+  else
+    {
+      error = qexec_hash_join_build_and_probe (thread_p, hashjoin_proc, build_list_id, probe_list_id, list_id);
+    }
+
+  if (error != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+exit_on_end:
+  return error;
+
+exit_on_error:
+  if (error == NO_ERROR)
+    {
+      error = er_errid ();
+      if (error == NO_ERROR)
+	{
+	  error = ER_FAILED;
+	}
+    }
+
+  goto exit_on_end;
+}
+
+/*
+ * qexec_hash_join_build_and_probe () - build a hash table on a build list file and probe it with a probe list file
+ *   return: error code
+ *   hashjoin_proc(in): hash join node, whose hash_scan is set up for build_list_id
+ *   build_list_id(in): build input or one of its partitions
+ *   probe_list_id(in): probe input or the partition matching build_list_id
+ *   list_id(in): result list file
+ */
+static int
+qexec_hash_join_build_and_probe (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_proc,
+				 QFILE_LIST_ID * build_list_id, QFILE_LIST_ID * probe_list_id, QFILE_LIST_ID * list_id)
+{
+  QFILE_LIST_SCAN_ID build_list_scan_id, probe_list_scan_id;
+
+  HASHJOIN_STATS *stats;
+
+  bool on_trace = thread_is_on_trace (thread_p);
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+  UINT64 old_fetches = 0, old_ioreads = 0, old_fetch_time = 0;
+
+  int error = NO_ERROR;
+
+  assert (hashjoin_proc->hash_scan.hash_list_scan_type != HASH_METH_NOT_USE);
+
   /* Prevent faults when qfile_close_scan is called */
   build_list_scan_id.status = S_CLOSED;
   probe_list_scan_id.status = S_CLOSED;
@@ -7274,7 +7770,12 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   if (on_trace)
     {
       stats = &(hashjoin_proc->stats);
-      stats->hash_method = hashjoin_proc->hash_scan.hash_list_scan_type;
+
+      /* Partitions may be joined by different methods. Show the most expensive one. */
+      if (stats->hash_method < hashjoin_proc->hash_scan.hash_list_scan_type)
+	{
+	  stats->hash_method = hashjoin_proc->hash_scan.hash_list_scan_type;
+	}
     }
 
   /**
@@ -7283,7 +7784,7 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   error = qfile_open_list_scan (build_list_id, &build_list_scan_id);
   if (error != NO_ERROR)
     {
-      GOTO_EXIT_ON_ERROR;
+      goto exit_on_error;
     }
 
   if (on_trace)
@@ -7303,7 +7804,6 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
       TSC_ADD_TIMEVAL (stats->build.build_time, tv_diff);
       TSC_ADD_TIMEVAL (stats->build.elapsed_time, tv_diff);
-      TSC_ADD_TIMEVAL (stats->build.elapsed_time, build_xasl->xasl_stats.elapsed_time);
 
       stats->build.fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
       stats->build.ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
@@ -7314,7 +7814,7 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 
   if (error != NO_ERROR)
     {
-      GOTO_EXIT_ON_ERROR;
+      goto exit_on_error;
     }
 
   /**
@@ -7323,7 +7823,7 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   error = qfile_open_list_scan (probe_list_id, &probe_list_scan_id);
   if (error != NO_ERROR)
     {
-      GOTO_EXIT_ON_ERROR;
+      goto exit_on_error;
     }
 
   if (on_trace)
@@ -7343,7 +7843,6 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
       TSC_ADD_TIMEVAL (stats->probe.probe_time, tv_diff);
       TSC_ADD_TIMEVAL (stats->probe.elapsed_time, tv_diff);
-      TSC_ADD_TIMEVAL (stats->probe.elapsed_time, probe_xasl->xasl_stats.elapsed_time);
 
       stats->probe.fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
       stats->probe.ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
@@ -7354,7 +7853,7 @@ qexec_hash_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 
   if (error != NO_ERROR)
     {
-      GOTO_EXIT_ON_ERROR;
+      goto exit_on_error;
     }
 
 exit_on_end:
@@ -7376,6 +7875,299 @@ exit_on_error:
   goto exit_on_end;
 }
 
+/*
+ * qexec_hash_join_need_partition () - whether the inputs of a hash join are partitioned before they are joined
+ *   return: true if the build input does not fit in max_hash_list_scan_size
+ *   hashjoin_proc(in): hash join node
+ *   build_list_id(in): build input
+ *
+ * Note: Probing an on-disk hash (HASH_METH_HYBRID or HASH_METH_HASH_FILE) costs a random page read per match.
+ *       Splitting both inputs by the hash of the key into partitions whose build side fits in memory turns it
+ *       into sequential I/O on temp files. Outer joins keep the on-disk hash since they scan the probe input
+ *       through the access spec.
+ */
+static bool
+qexec_hash_join_need_partition (HASHJOIN_PROC_NODE * hashjoin_proc, QFILE_LIST_ID * build_list_id)
+{
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+
+  if (hashjoin_proc->merge_info.join_type != JOIN_INNER || mem_limit == 0)
+    {
+      return false;
+    }
+
+  return (UINT64) build_list_id->page_cnt * DB_PAGESIZE > mem_limit;
+}
+
+/*
+ * qexec_hash_join_partitioned () - join the inputs partition by partition
+ *   return: error code
+ *   hashjoin_proc(in): hash join node
+ *   build_list_id(in): build input, or a partition of it when called recursively
+ *   probe_list_id(in): probe input, or the partition matching build_list_id
+ *   level(in): recursion level
+ *   list_id(in): result list file
+ *
+ * Note: Tuples of equal keys fall into the same partition on both sides, so joining the pairs of partitions
+ *       gives the result of the whole join. A build partition that is still too large is partitioned again
+ *       with other hash bits, unless it did not shrink, which means most of it has a single key.
+ */
+static int
+qexec_hash_join_partitioned (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_proc,
+			     QFILE_LIST_ID * build_list_id, QFILE_LIST_ID * probe_list_id, int level,
+			     QFILE_LIST_ID * list_id)
+{
+  QFILE_LIST_ID *build_part_list_ids[HASHJOIN_PARTITION_MAX_CNT];
+  QFILE_LIST_ID *probe_part_list_ids[HASHJOIN_PARTITION_MAX_CNT];
+  QFILE_LIST_ID *build_part_list_id, *probe_part_list_id;
+
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+  UINT64 build_size;
+  int partition_cnt, part_index;
+
+  HASHJOIN_STATS *stats;
+
+  bool on_trace = thread_is_on_trace (thread_p);
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+
+  int error = NO_ERROR;
+
+  for (part_index = 0; part_index < HASHJOIN_PARTITION_MAX_CNT; part_index++)
+    {
+      build_part_list_ids[part_index] = NULL;
+      probe_part_list_ids[part_index] = NULL;
+    }
+
+  build_size = (UINT64) build_list_id->page_cnt * DB_PAGESIZE;
+
+  partition_cnt = HASHJOIN_PARTITION_MIN_CNT;
+  while (partition_cnt < HASHJOIN_PARTITION_MAX_CNT && (UINT64) partition_cnt * mem_limit < build_size)
+    {
+      partition_cnt *= 2;
+    }
+
+  if (on_trace)
+    {
+      stats = &(hashjoin_proc->stats);
+      stats->build.partitions += partition_cnt;
+
+      tsc_getticks (&start_tick);
+    }
+
+  error =
+    qexec_hash_join_partition (thread_p, hashjoin_proc, hashjoin_proc->build, build_list_id, level, partition_cnt,
+			       build_part_list_ids);
+  if (error != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  error =
+    qexec_hash_join_partition (thread_p, hashjoin_proc, hashjoin_proc->probe, probe_list_id, level, partition_cnt,
+			       probe_part_list_ids);
+  if (error != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  if (on_trace)
+    {
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      TSC_ADD_TIMEVAL (stats->build.elapsed_time, tv_diff);
+    }
+
+  for (part_index = 0; part_index < partition_cnt; part_index++)
+    {
+      build_part_list_id = build_part_list_ids[part_index];
+      probe_part_list_id = probe_part_list_ids[part_index];
+
+      if (build_part_list_id->tuple_cnt > 0 && probe_part_list_id->tuple_cnt > 0)
+	{
+	  if (level + 1 < HASHJOIN_PARTITION_MAX_LEVEL
+	      && (UINT64) build_part_list_id->page_cnt * DB_PAGESIZE > mem_limit
+	      && build_part_list_id->page_cnt < build_list_id->page_cnt)
+	    {
+	      error =
+		qexec_hash_join_partitioned (thread_p, hashjoin_proc, build_part_list_id, probe_part_list_id, level + 1,
+					     list_id);
+	    }
+	  else
+	    {
+	      qexec_hash_join_scan_clear (thread_p, &(hashjoin_proc->hash_scan));
+
+	      error =
+		qexec_hash_join_scan_init (thread_p, &(hashjoin_proc->hash_scan), build_part_list_id,
+					   hashjoin_proc->merge_info.ls_column_cnt);
+	      if (error == NO_ERROR)
+		{
+		  hashjoin_proc->hash_scan.need_coerce_type = hashjoin_proc->need_coerce_domains;
+
+		  error =
+		    qexec_hash_join_build_and_probe (thread_p, hashjoin_proc, build_part_list_id, probe_part_list_id,
+						     list_id);
+		}
+	    }
+
+	  if (error != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+
+      /* Give back the temp pages of the pair as soon as it is joined. */
+      qexec_destroy_partition_lists (thread_p, &build_part_list_ids[part_index], 1);
+      qexec_destroy_partition_lists (thread_p, &probe_part_list_ids[part_index], 1);
+    }
+
+exit_on_end:
+  qexec_destroy_partition_lists (thread_p, build_part_list_ids, partition_cnt);
+  qexec_destroy_partition_lists (thread_p, probe_part_list_ids, partition_cnt);
+
+  return error;
+
+exit_on_error:
+  if (error == NO_ERROR)
+    {
+      error = er_errid ();
+      if (error == NO_ERROR)
+	{
+	  error = ER_FAILED;
+	}
+    }
+
+  goto exit_on_end;
+}
+
+/*
+ * qexec_hash_join_partition () - distribute the tuples of a list file into partitions by the hash of their keys
+ *   return: error code
+ *   hashjoin_proc(in): hash join node
+ *   input(in): build or probe input, giving the domains and positions of the key values
+ *   list_id(in): list file to partition
+ *   level(in): recursion level, which selects the hash bits
+ *   partition_cnt(in): number of partitions, a power of 2
+ *   part_list_ids(out): closed partition list files, on the type list of list_id
+ */
+static int
+qexec_hash_join_partition (THREAD_ENTRY * thread_p, HASHJOIN_PROC_NODE * hashjoin_proc, HASHJOIN_INPUT * input,
+			   QFILE_LIST_ID * list_id, int level, int partition_cnt, QFILE_LIST_ID ** part_list_ids)
+{
+  QFILE_LIST_SCAN_ID list_scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  SCAN_CODE qp_scan;
+
+  HASH_SCAN_KEY *key;
+  unsigned int hash_key;
+  int part_index;
+
+  int error = NO_ERROR;
+  bool exit_on_next;
+
+  assert (partition_cnt >= HASHJOIN_PARTITION_MIN_CNT && partition_cnt <= HASHJOIN_PARTITION_MAX_CNT);
+  assert ((partition_cnt & (partition_cnt - 1)) == 0);
+
+  /* Prevent faults when qfile_close_scan is called */
+  list_scan_id.status = S_CLOSED;
+
+  key = hashjoin_proc->hash_scan.temp_key;
+  assert (key != NULL);
+
+  for (part_index = 0; part_index < partition_cnt; part_index++)
+    {
+      part_list_ids[part_index] =
+	qfile_open_list (thread_p, &(list_id->type_list), NULL, list_id->query_id, QFILE_FLAG_ALL, NULL);
+      if (part_list_ids[part_index] == NULL)
+	{
+	  goto exit_on_error;
+	}
+    }
+
+  error = qfile_open_list_scan (list_id, &list_scan_id);
+  if (error != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  while ((qp_scan = qfile_scan_list_next (thread_p, &list_scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+    {
+      error =
+	qexec_hash_join_fetch_key (thread_p, hashjoin_proc, input->domains, input->value_indexes, &tuple_record, key,
+				   NULL /* compare_key */ , &exit_on_next);
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      else if (exit_on_next == true)
+	{
+	  /* A tuple with a null key does not join. */
+	  continue;
+	}
+
+      hash_key = qdata_hash_scan_key (key, UINT_MAX, HASH_METH_IN_MEM);
+      part_index = qexec_hash_partition_index (hash_key, level, partition_cnt);
+
+      error = qfile_add_tuple_to_list (thread_p, part_list_ids[part_index], tuple_record.tpl);
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+    }
+
+  if (qp_scan == S_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  qfile_close_scan (thread_p, &list_scan_id);
+
+  for (part_index = 0; part_index < partition_cnt; part_index++)
+    {
+      qfile_close_list (thread_p, part_list_ids[part_index]);
+    }
+
+  return NO_ERROR;
+
+exit_on_error:
+  if (error == NO_ERROR)
+    {
+      error = er_errid ();
+      if (error == NO_ERROR)
+	{
+	  error = ER_FAILED;
+	}
+    }
+
+  qfile_close_scan (thread_p, &list_scan_id);
+
+  qexec_destroy_partition_lists (thread_p, part_list_ids, partition_cnt);
+
+  return error;
+}
+
+/*
+ * qexec_destroy_partition_lists () - destroy partition list files
+ *   return:
+ *   part_list_ids(in/out): partition list files, set to NULL
+ *   partition_cnt(in): number of partitions
+ */
+static void
+qexec_destroy_partition_lists (THREAD_ENTRY * thread_p, QFILE_LIST_ID ** part_list_ids, int partition_cnt)
+{
+  int part_index;
+
+  for (part_index = 0; part_index < partition_cnt; part_index++)
+    {
+      if (part_list_ids[part_index] != NULL)
+	{
+	  qfile_close_list (thread_p, part_list_ids[part_index]);
+	  qfile_destroy_list (thread_p, part_list_ids[part_index]);
+	  QFILE_FREE_AND_INIT_LIST_ID (part_list_ids[part_index]);
+	}
+    }
+}
+
 static int
 qexec_hash_outer_join_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				HASHJOIN_PROC_NODE * hashjoin_proc, QFILE_LIST_ID * list_id)
@@ -9031,6 +9823,27 @@ exit_on_error:
   return error;
 }
 
+/*
+ * qexec_hash_partition_index () - select the partition of a key by the bits of its hash
+ *   return: partition index
+ *   hash_key(in): hash of the key
+ *   level(in): recursion level
+ *   partition_cnt(in): number of partitions, a power of 2
+ */
+STATIC_INLINE int
+qexec_hash_partition_index (unsigned int hash_key, int level, int partition_cnt)
+{
+  /* Scramble the hash with a seed of the level, so that a partition split again spreads over new bits. */
+  hash_key += (unsigned int) (level + 1) * 0x9e3779b9U;
+  hash_key ^= hash_key >> 16;
+  hash_key *= 0x85ebca6bU;
+  hash_key ^= hash_key >> 13;
+  hash_key *= 0xc2b2ae35U;
+  hash_key ^= hash_key >> 16;
+
+  return (int) (hash_key & (unsigned int) (partition_cnt - 1));
+}
+
 /*
  * Interpreter routines
  */
@@ -10529,6 +11342,20 @@ qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_s
 		      count_star_with_iscan_opt = true;
 		    }
 		}
+	      else if (!is_scan_ptr)
+		{
+		  bool is_counted = false;
+
+		  if (qexec_evaluate_count_star_parallel (thread_p, xasl, &is_counted) != NO_ERROR)
+		    {
+		      return S_ERROR;
+		    }
+		  if (is_counted)
+		    {
+		      /* the heap was counted by a parallel scan */
+		      return S_SUCCESS;
+		    }
+		}
 	    }
 	}
     }
@@ -26676,6 +27503,82 @@ qexec_evaluate_aggregates_optimize (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * ag
   return error;
 }
 
+/*
+ * qexec_evaluate_count_star_parallel () - evaluate a lone COUNT(*) over a heap with a parallel scan
+ * return : error code
+ * thread_p (in)    : thread entry
+ * xasl (in)	    : buildvalue xasl with a single COUNT(*) aggregate
+ * is_counted (out) : true if the count was evaluated, false if the heap must be scanned sequentially
+ *
+ * Note: Applies to a single class without any predicate, when parallel_scan_degree is above one or the query has the
+ *	 PARALLEL_SCAN hint. The pages of the heap are divided among several threads, each counting the objects visible
+ *	 to the snapshot of the transaction; the partial counts are summed into the aggregate. The caller falls back to
+ *	 the sequential scan only when the query cannot be counted this way; errors of the scan are returned.
+ */
+static int
+qexec_evaluate_count_star_parallel (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool * is_counted)
+{
+  ACCESS_SPEC_TYPE *specp = xasl->spec_list;
+  AGGREGATE_TYPE *agg_p = xasl->proc.buildvalue.agg_list;
+  MVCC_SNAPSHOT *mvcc_snapshot;
+  INT64 count = 0;
+  int degree;
+  int error_code;
+
+  *is_counted = false;
+
+  assert (xasl->type == BUILDVALUE_PROC && agg_p != NULL && agg_p->function == PT_COUNT_STAR);
+
+  degree = prm_get_integer_value (PRM_ID_PARALLEL_SCAN_DEGREE);
+  if (degree < 2 && XASL_IS_FLAGED (xasl, XASL_PARALLEL_SCAN))
+    {
+      /* requested by hint while parallel_scan_degree is not set */
+      degree = heap_parallel_scan_default_degree ();
+    }
+  if (degree < 2)
+    {
+      return NO_ERROR;
+    }
+
+  if (specp == NULL || specp->next != NULL || specp->type != TARGET_CLASS || specp->access != ACCESS_METHOD_SEQUENTIAL
+      || specp->pruning_type != DB_NOT_PARTITIONED_CLASS || (specp->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+      || specp->where_pred != NULL || specp->where_key != NULL || specp->where_range != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (xasl->bptr_list != NULL || xasl->dptr_list != NULL || xasl->if_pred != NULL || xasl->after_join_pred != NULL
+      || XASL_IS_FLAGED (xasl, XASL_SAMPLING_SCAN))
+    {
+      return NO_ERROR;
+    }
+
+  if (OID_IS_ROOTOID (&ACCESS_SPEC_CLS_OID (specp)) || mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (specp)))
+    {
+      return NO_ERROR;
+    }
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      /* system transactions do not have snapshots */
+      return NO_ERROR;
+    }
+
+  error_code = heap_parallel_count_objects (thread_p, &ACCESS_SPEC_HFID (specp), &ACCESS_SPEC_CLS_OID (specp),
+					    mvcc_snapshot, degree, &count);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  agg_p->accumulator.curr_cnt += count;
+  *is_counted = true;
+
+  return NO_ERROR;
+}
+
 /*
  * qexec_setup_topn_proc () - setup a top-n object
  * return : error code or NO_ERROR
@@ -27599,6 +28502,9 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->curr_part_value = NULL;
   proc->agg_hash_context->sort_key.key = NULL;
   proc->agg_hash_context->sort_key.nkeys = 0;
+  proc->agg_hash_context->spill_list_ids = NULL;
+  proc->agg_hash_context->spill_tuple.size = 0;
+  proc->agg_hash_context->spill_tuple.tpl = NULL;
 
   /*
    * create temporary dbvalue array
@@ -27934,6 +28840,20 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
       proc->agg_hash_context->tuple_recdes.area_size = 0;
     }
 
+  /* free spill partitions */
+  if (proc->agg_hash_context->spill_list_ids != NULL)
+    {
+      qexec_destroy_partition_lists (thread_p, proc->agg_hash_context->spill_list_ids,
+				     HASH_AGGREGATE_SPILL_PARTITION_CNT);
+      db_private_free_and_init (thread_p, proc->agg_hash_context->spill_list_ids);
+    }
+
+  if (proc->agg_hash_context->spill_tuple.tpl != NULL)
+    {
+      db_private_free_and_init (thread_p, proc->agg_hash_context->spill_tuple.tpl);
+      proc->agg_hash_context->spill_tuple.size = 0;
+    }
+
   /* reinit counters */
   proc->agg_hash_context->hash_size = 0;
   proc->agg_hash_context->group_count = 0;
@@ -2854,6 +2854,9 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* attribute information from predicates */
   scan_init_scan_attrs (&hsidp->pred_attrs, num_attrs_pred, attrids_pred, cache_pred);
 
+  /* compiled when the scan starts and the class representation is known */
+  hsidp->raw_filter = NULL;
+
   /* regulator variable list for other than predicates */
   hsidp->rest_regu_list = regu_list_rest;
 
@@ -4157,6 +4160,17 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	  hsidp->caches_inited = true;
 	}
+      if (hsidp->raw_filter == NULL && hsidp->scan_pred.pred_expr != NULL
+	  && prm_get_bool_value (PRM_ID_HEAP_SCAN_RAW_FILTER))
+	{
+	  ret =
+	    eval_raw_filter_build (thread_p, hsidp->scan_pred.pred_expr, scan_id->vd, hsidp->pred_attrs.attr_cache,
+				   &hsidp->raw_filter);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
       break;
 
     case S_HEAP_PAGE_SCAN:
@@ -4693,6 +4707,12 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 
       /* do not free attr_cache here. xs_clear_access_spec_list() will free attr_caches. */
 
+      if (hsidp->raw_filter != NULL)
+	{
+	  eval_raw_filter_free (thread_p, hsidp->raw_filter);
+	  hsidp->raw_filter = NULL;
+	}
+
       if (scan_id->grouped)
 	{
 	  if (hsidp->scanrange_inited)
@@ -4805,10 +4825,17 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     {
     case S_HEAP_SCAN:
     case S_HEAP_SCAN_RECORD_INFO:
+    case S_HEAP_SAMPLING_SCAN:
+      if (scan_id->s.hsid.raw_filter != NULL)
+	{
+	  eval_raw_filter_free (thread_p, scan_id->s.hsid.raw_filter);
+	  scan_id->s.hsid.raw_filter = NULL;
+	}
+      break;
+
     case S_HEAP_PAGE_SCAN:
     case S_CLASS_ATTR_SCAN:
     case S_VALUES_SCAN:
-    case S_HEAP_SAMPLING_SCAN:
       break;
 
     case S_INDX_SCAN:
@@ -5202,9 +5229,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 {
   HEAP_SCAN_ID *hsidp;
   FILTER_INFO data_filter;
+  SCAN_PRED fetch_pred;
+  FILTER_INFO fetch_filter;
   RECDES recdes = RECDES_INITIALIZER;
   SCAN_CODE sp_scan;
-  DB_LOGICAL ev_res;
+  DB_LOGICAL ev_res, raw_res;
   OID current_oid, *p_current_oid = NULL;
   MVCC_SCAN_REEV_DATA mvcc_sel_reev_data;
   MVCC_REEV_DATA mvcc_reev_data;
@@ -5229,6 +5258,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   scan_init_filter_info (&data_filter, &hsidp->scan_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
 			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
 
+  /* once the raw filter has qualified a record it covers entirely, only the values remain to be fetched */
+  scan_init_scan_pred (&fetch_pred, hsidp->scan_pred.regu_list, NULL, NULL);
+  scan_init_filter_info (&fetch_filter, &fetch_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
+			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
+
   is_peeking = scan_id->fixed;
   if (scan_id->grouped)
     {
@@ -5318,7 +5352,25 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       /* evaluate the predicates to see if the object qualifies */
       scan_id->scan_stats.read_rows++;
 
-      ev_res = eval_data_filter (thread_p, p_current_oid, &recdes, &hsidp->scan_cache, &data_filter);
+      raw_res = V_UNKNOWN;
+      if (hsidp->raw_filter != NULL && scan_id->qualification == QPROC_QUALIFIED)
+	{
+	  raw_res = eval_raw_filter (hsidp->raw_filter, &recdes);
+	  if (raw_res == V_FALSE)
+	    {
+	      /* nothing was decoded and the page was not released; no need to check for page changes */
+	      continue;
+	    }
+	}
+
+      if (raw_res == V_TRUE && eval_raw_filter_covers_pred (hsidp->raw_filter))
+	{
+	  ev_res = eval_data_filter (thread_p, p_current_oid, &recdes, &hsidp->scan_cache, &fetch_filter);
+	}
+      else
+	{
+	  ev_res = eval_data_filter (thread_p, p_current_oid, &recdes, &hsidp->scan_cache, &data_filter);
+	}
       if (ev_res == V_ERROR)
 	{
 	  return S_ERROR;
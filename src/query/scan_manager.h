@@ -110,6 +110,7 @@ struct heap_scan_id
   HEAP_SCANRANGE scan_range;	/* heap file scan range */
   SCAN_PRED scan_pred;		/* scan predicates(filters) */
   SCAN_ATTRS pred_attrs;	/* attr info from predicates */
+  RAW_FILTER *raw_filter;	/* conjuncts of scan_pred evaluated on the raw record */
   regu_variable_list_node *rest_regu_list;	/* regulator variable list */
   SCAN_ATTRS rest_attrs;	/* attr info from other than preds */
   bool caches_inited;		/* are the caches initialized?? */
@@ -7117,6 +7117,9 @@ vacuum_log_prefetch_vacuum_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * e
   worker->prefetch_first_pageid = VACUUM_FIRST_LOG_PAGEID_IN_BLOCK (entry->get_blockid ());
   worker->prefetch_last_pageid = worker->prefetch_first_pageid + VACUUM_PREFETCH_LOG_BLOCK_BUFFER_PAGES - 1;
 
+  /* have the whole block read from disk at once instead of page by page below */
+  logpb_prefetch_log_pages (thread_p, worker->prefetch_first_pageid, worker->prefetch_last_pageid);
+
   for (log_pageid = worker->prefetch_first_pageid, log_page = (LOG_PAGE *) worker->prefetch_log_buffer;
        log_pageid <= worker->prefetch_last_pageid;
        log_pageid++, log_page = (LOG_PAGE *) (((char *) log_page) + LOG_PAGESIZE))
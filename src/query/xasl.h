@@ -394,6 +394,7 @@ struct hashjoin_stats
     UINT64 fetches;
     UINT64 fetch_time;
     UINT64 ioreads;
+    UINT32 partitions;		/* partitions the inputs were split into, 0 if joined as a whole */
 
 #if defined(TEST_HASH_JOIN_PROFILE_TIME)
     struct
@@ -586,6 +587,7 @@ struct cte_proc_node
 #define XASL_INCLUDES_TDE_CLASS	      0x10000	/* is any tde class related */
 #define XASL_SAMPLING_SCAN	      0x20000	/* is sampling scan */
 #define XASL_USES_SQ_CACHE	      0x40000	/* subquery uses result cache */
+#define XASL_PARALLEL_SCAN	      0x80000	/* heap may be scanned by several threads */
 
 #define XASL_IS_FLAGED(x, f)        (((x)->flag & (int) (f)) != 0)
 #define XASL_SET_FLAG(x, f)         (x)->flag |= (int) (f)
@@ -1027,6 +1029,9 @@ struct groupby_stat
   AGGREGATE_HASH_STATE groupby_hash;
   bool run_groupby;
   bool groupby_sort;
+  UINT64 spill_memory;		/* max_agg_hash_size the hash table overflowed */
+  UINT64 spill_rows;		/* tuples written to spill partitions */
+  int spill_partitions;		/* spill partitions, 0 if the hash table did not overflow */
 };
 
 struct xasl_stat
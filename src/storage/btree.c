@@ -1466,6 +1466,10 @@ static int btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID *
 static int btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				    PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				    bool * stop, bool * restart, void *other_args);
+#if defined (SERVER_MODE)
+static PAGE_PTR btree_fix_leaf_optimistic (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+					   bool reuse_btid_int);
+#endif /* SERVER_MODE */
 static int btree_advance_and_find_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 				       PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 				       BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
@@ -1740,6 +1744,7 @@ static bool btree_is_single_object_key (THREAD_ENTRY * thread_p, BTID_INT * btid
 
 static bool btree_check_locking_for_insert_unique (THREAD_ENTRY * thread_p, const BTREE_INSERT_HELPER * insert_helper);
 static bool btree_check_locking_for_delete_unique (THREAD_ENTRY * thread_p, const BTREE_DELETE_HELPER * delete_helper);
+static bool btree_is_own_insert_lock_elided (THREAD_ENTRY * thread_p, const BTREE_MVCC_INFO * mvcc_info);
 
 static DISK_ISVALID btree_check_tree (THREAD_ENTRY * thread_p, const OID * class_oid_p, BTID * btid,
 				      const char *btname);
@@ -23398,6 +23403,22 @@ btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_i
 
   bool reuse_btid_int = other_args ? *((bool *) other_args) : false;
 
+#if defined (SERVER_MODE)
+  /* Try to reach the leaf without latching the root and the other non-leaf nodes. */
+  *root_page = btree_fix_leaf_optimistic (thread_p, btid, btid_int, key, reuse_btid_int);
+  if (*root_page != NULL)
+    {
+      *is_leaf = true;
+      error_code = btree_search_leaf_page (thread_p, btid_int, *root_page, key, search_key);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE */
+
   /* Get root page and BTID_INT. */
   *root_page =
     btree_fix_root_with_info (thread_p, btid, PGBUF_LATCH_READ, NULL, &root_header, (reuse_btid_int ? NULL : btid_int));
@@ -23430,6 +23451,128 @@ btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_i
   return NO_ERROR;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * btree_fix_leaf_optimistic () - Descend from root to the leaf that may contain key by reading the non-leaf nodes
+ *				  optimistically (without fixing them) and fix the leaf with read latch.
+ *
+ * return	       : Fixed leaf page or NULL if the optimistic descent failed.
+ * thread_p (in)       : Thread entry.
+ * btid (in)	       : B-tree identifier.
+ * btid_int (out)      : B-tree info.
+ * key (in)	       : Search key value.
+ * reuse_btid_int (in) : True if b-tree info is already set.
+ *
+ * NOTE: Each non-leaf node is copied by pgbuf_read_optimistic (). A child pointer read from a node remains valid as
+ *	 long as the node is not write latched, since splits and merges of the child must modify it. Therefore the
+ *	 node read is validated again after its child is read (or fixed, for the leaf). Any failure is not an error;
+ *	 caller must follow the regular path that latches the nodes.
+ */
+static PAGE_PTR
+btree_fix_leaf_optimistic (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+			   bool reuse_btid_int)
+{
+  char page_copy_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  char *page_copy = PTR_ALIGN (page_copy_buf, MAX_ALIGNMENT);
+  PGBUF_OPTIMISTIC_READ crt_read, parent_read;
+  PAGE_PTR page = NULL;
+  PAGE_PTR leaf_page = NULL;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
+  VPID vpid;
+  INT16 slotid;
+  int node_level;
+
+  vpid.pageid = btid->root_pageid;
+  vpid.volid = btid->vfid.volid;
+
+  page = pgbuf_read_optimistic (thread_p, &vpid, page_copy, &crt_read);
+  if (page == NULL)
+    {
+      /* Root is not in buffer or it is being modified. */
+      return NULL;
+    }
+  root_header = btree_get_root_header (thread_p, page);
+  if (root_header == NULL || root_header->node.node_level <= 1)
+    {
+      /* Root is leaf, there is nothing to gain. */
+      return NULL;
+    }
+  node_level = root_header->node.node_level;
+
+  if (!reuse_btid_int)
+    {
+      btid_int->sys_btid = btid;
+      if (btree_glean_root_header_info (thread_p, root_header, btid_int, true) != NO_ERROR)
+	{
+	  goto fail;
+	}
+    }
+  if (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY && key->data.midxkey.domain == NULL)
+    {
+      /* Use domain from b-tree info. */
+      key->data.midxkey.domain = btid_int->key_type;
+    }
+
+  while (true)
+    {
+      if (btree_search_nonleaf_page (thread_p, btid_int, page, key, &slotid, &vpid, NULL) != NO_ERROR)
+	{
+	  goto fail;
+	}
+      assert (!VPID_ISNULL (&vpid));
+
+      node_level--;
+      if (node_level == 1)
+	{
+	  /* Child is leaf. */
+	  break;
+	}
+
+      /* Copy child over current node; only its read is needed from now on. */
+      parent_read = crt_read;
+      page = pgbuf_read_optimistic (thread_p, &vpid, page_copy, &crt_read);
+      if (page == NULL || !pgbuf_is_optimistic_read_valid (&parent_read))
+	{
+	  goto fail;
+	}
+      node_header = btree_get_node_header (thread_p, page);
+      if (node_header == NULL || node_header->node_level != node_level)
+	{
+	  goto fail;
+	}
+    }
+
+  /* Fix leaf. The page may have been deallocated if the parent was changed in the meantime. */
+  if (!pgbuf_is_optimistic_read_valid (&crt_read))
+    {
+      goto fail;
+    }
+  leaf_page = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (leaf_page == NULL)
+    {
+      goto fail;
+    }
+  if (!pgbuf_is_optimistic_read_valid (&crt_read))
+    {
+      /* Parent was changed, leaf may not be the one to follow anymore. */
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+      goto fail;
+    }
+  assert (btree_get_node_header (thread_p, leaf_page) != NULL
+	  && btree_get_node_header (thread_p, leaf_page)->node_level == 1);
+
+  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_OPTIMISTIC_DESCENTS);
+  return leaf_page;
+
+fail:
+  /* Fall back to latched descent. */
+  er_clear ();
+  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_OPTIMISTIC_DESCENT_FAILS);
+  return NULL;
+}
+#endif /* SERVER_MODE */
+
 /*
  * btree_advance_and_find_key () - Fix next node in b-tree following given key.
  *				   If argument is leaf-node, return if key is found and the slot if key instead.
@@ -23782,6 +23925,12 @@ btree_key_find_and_lock_unique_of_unique (THREAD_ENTRY * thread_p, BTID_INT * bt
 #else	/* !SA_MODE */	       /* SERVER_MODE */
 	  /* Object is being inserted/deleted. We need to lock and suspend until it's fate is decided. */
 	  assert (!lock_has_lock_on_object (&unique_oid, &unique_class_oid, find_unique_helper->lock_mode));
+	  if (satisfies_delete == DELETE_RECORD_INSERT_IN_PROGRESS)
+	    {
+	      /* The inserter may have left the lock to the insert MVCCID; make it real so we can wait for it. */
+	      (void) lock_inflate_elided_object_lock (thread_p, &unique_oid, &unique_class_oid,
+						      mvcc_header.mvcc_ins_id);
+	    }
 #endif /* SERVER_MODE */
 	  /* Fall through. */
 	case DELETE_RECORD_CAN_DELETE:
@@ -24094,6 +24243,12 @@ btree_key_find_and_lock_unique_of_non_unique (THREAD_ENTRY * thread_p, BTID_INT
 #else	/* !SA_MODE */	       /* SERVER_MODE */
 	  /* Object is being inserted/deleted. We need to lock and suspend until it's fate is decided. */
 	  assert (!lock_has_lock_on_object (&unique_oid, &unique_class_oid, find_unique_helper->lock_mode));
+	  if (satisfies_delete == DELETE_RECORD_INSERT_IN_PROGRESS)
+	    {
+	      /* The inserter may have left the lock to the insert MVCCID; make it real so we can wait for it. */
+	      (void) lock_inflate_elided_object_lock (thread_p, &unique_oid, &unique_class_oid,
+						      mvcc_header.mvcc_ins_id);
+	    }
 #endif /* SERVER_MODE */
 	  /* Fall through. */
 	case DELETE_RECORD_CAN_DELETE:
@@ -25343,6 +25498,7 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
 	  else
 	    {
 	      /* Fix next leaf page. */
+	      pgbuf_read_ahead_notify (thread_p, &bts->read_ahead, &next_vpid);
 	      next_node_page = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
 	      if (next_node_page == NULL)
 		{
@@ -36332,7 +36488,7 @@ btree_check_locking_for_insert_unique (THREAD_ENTRY * thread_p, const BTREE_INSE
       return true;
     }
 
-  return false;
+  return btree_is_own_insert_lock_elided (thread_p, BTREE_INSERT_MVCC_INFO (insert_helper));
 }
 
 static bool
@@ -36362,7 +36518,25 @@ btree_check_locking_for_delete_unique (THREAD_ENTRY * thread_p, const BTREE_DELE
       return true;
     }
 
-  return false;
+  return btree_is_own_insert_lock_elided (thread_p, BTREE_DELETE_MVCC_INFO (delete_helper));
+}
+
+/*
+ * btree_is_own_insert_lock_elided () - is the missing instance lock of an object left to its insert MVCCID?
+ *
+ * return: true if lock_elide_insert_locks is on and the object was inserted by the current transaction
+ * thread_p (in) : Thread entry.
+ * mvcc_info (in) : MVCC info of the object.
+ */
+static bool
+btree_is_own_insert_lock_elided (THREAD_ENTRY * thread_p, const BTREE_MVCC_INFO * mvcc_info)
+{
+  if (!prm_get_bool_value (PRM_ID_LK_ELIDE_INSERT_LOCKS) || !BTREE_MVCC_INFO_IS_INSID_NOT_ALL_VISIBLE (mvcc_info))
+    {
+      return false;
+    }
+
+  return logtb_is_current_mvccid (thread_p, BTREE_MVCC_INFO_INSID (mvcc_info));
 }
 
 // *INDENT-OFF*
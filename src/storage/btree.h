@@ -215,6 +215,8 @@ struct btree_scan
 
   PAGE_PTR C_page;		/* page ptr to current leaf page */
 
+  PGBUF_READ_AHEAD read_ahead;	/* sequential read-ahead state of leaf chain */
+
   INT16 slot_id;		/* current slot identifier */
 
   /* TO BE REMOVED */
@@ -342,6 +344,7 @@ struct btree_scan
     (bts)->time_track.is_perf_tracking = false;		\
     (bts)->bts_other = NULL;				\
     (bts)->is_fk_remake = false;                        \
+    pgbuf_read_ahead_init (&(bts)->read_ahead);		\
   } while (0)
 
 #define BTREE_RESET_SCAN(bts)				\
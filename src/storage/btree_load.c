@@ -3215,7 +3215,8 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
 	}
     }
 
-  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
+  /* the in-memory runs are sorted with sort_parallel_degree threads, as for any other sort */
+  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* size unknown, use all sort buffers */ ,
 			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
 			NO_SORT_LIMIT, includes_tde_class);
 }
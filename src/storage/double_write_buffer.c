@@ -63,6 +63,12 @@
 /* LOG2 from total number of blocks. */
 #define DWB_LOG2_BLOCK_NUM_PAGES	   (dwb_Global.log2_num_block_pages)
 
+/* The maximum number of pages handed at once to the I/O backend when writing a block. */
+#define DWB_WRITE_BATCH_MAX_PAGES	   256
+
+/* The maximum number of volumes synchronized at once after writing a block. */
+#define DWB_SYNC_BATCH_MAX_VOLUMES	   64
+
 
 /* Position mask. */
 #define DWB_POSITION_MASK	    0x000000003fffffff
@@ -355,6 +361,10 @@ STATIC_INLINE int dwb_block_create_ordered_slots (DWB_BLOCK * block, DWB_SLOT **
 static int dwb_compare_vol_fd (const void *v1, const void *v2);
 STATIC_INLINE FLUSH_VOLUME_INFO *dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
 								     int vol_fd) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int dwb_write_block_pages (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
+					 FILEIO_WRITE_REQUEST * write_requests, int num_write_requests,
+					 FLUSH_VOLUME_INFO * flush_volume_info, bool all_volume_pages_written,
+					 bool file_sync_helper_can_flush, int *count_writes) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_slots,
 				   unsigned int ordered_slots_length, bool file_sync_helper_can_flush,
 				   bool remove_from_hash) __attribute__ ((ALWAYS_INLINE));
@@ -1044,7 +1054,7 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
   block_buffer_size = num_block_pages * IO_PAGESIZE;
   for (i = 0; i < num_blocks; i++)
     {
-      blocks_write_buffer[i] = (char *) malloc (block_buffer_size * sizeof (char));
+      blocks_write_buffer[i] = (char *) fileio_alloc_aligned (block_buffer_size * sizeof (char));
       if (blocks_write_buffer[i] == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, block_buffer_size * sizeof (char));
@@ -1108,7 +1118,8 @@ exit_on_error:
 
       if (blocks_write_buffer[i] != NULL)
 	{
-	  free_and_init (blocks_write_buffer[i]);
+	  fileio_free_aligned (blocks_write_buffer[i]);
+	  blocks_write_buffer[i] = NULL;
 	}
 
       if (flush_volumes_info[i] != NULL)
@@ -1141,7 +1152,8 @@ dwb_finalize_block (DWB_BLOCK * block)
   /* destroy block write buffer */
   if (block->write_buffer != NULL)
     {
-      free_and_init (block->write_buffer);
+      fileio_free_aligned (block->write_buffer);
+      block->write_buffer = NULL;
     }
   if (block->flush_volumes_info != NULL)
     {
@@ -1989,6 +2001,81 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
   return flush_new_volume_info;
 }
 
+/*
+ * dwb_write_block_pages () - Write a batch of block pages that belong to the same volume.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * write_requests(in): The page writes.
+ * num_write_requests(in): The number of page writes.
+ * flush_volume_info(in): The volume of the pages.
+ * all_volume_pages_written(in): True, if these are the last pages of the volume.
+ * file_sync_helper_can_flush(in): True, if helper can flush.
+ * count_writes(in/out): Pages written since file sync helper was last woken.
+ */
+STATIC_INLINE int
+dwb_write_block_pages (THREAD_ENTRY * thread_p, DWB_BLOCK * block, FILEIO_WRITE_REQUEST * write_requests,
+		       int num_write_requests, FLUSH_VOLUME_INFO * flush_volume_info, bool all_volume_pages_written,
+		       bool file_sync_helper_can_flush, int *count_writes)
+{
+  FILEIO_PAGE *io_page;
+  int i;
+
+  assert (flush_volume_info != NULL);
+
+  if (num_write_requests > 0)
+    {
+      /* Write the data. */
+      if (fileio_write_batch (thread_p, write_requests, num_write_requests, IO_PAGESIZE,
+			      FILEIO_WRITE_NO_COMPENSATE_WRITE) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  dwb_log_error ("DWB write %d pages of volume %d with %d error: \n", num_write_requests,
+			 flush_volume_info->vdes, er_errid ());
+	  assert (false);
+	  /* Something wrong happened. */
+	  return ER_FAILED;
+	}
+
+      for (i = 0; i < num_write_requests; i++)
+	{
+	  io_page = (FILEIO_PAGE *) write_requests[i].io_page_p;
+	  dwb_log ("dwb_write_block: written page = (%d,%d) LSA=(%lld,%d)\n",
+		   io_page->prv.volid, io_page->prv.pageid, io_page->prv.lsa.pageid, (int) io_page->prv.lsa.offset);
+	}
+    }
+
+#if defined (SERVER_MODE)
+  /* Count the pages before marking the volume as written, the file sync helper relies on it. */
+  ATOMIC_INC_32 (&flush_volume_info->num_pages, num_write_requests);
+  *count_writes += num_write_requests;
+#endif
+
+  if (all_volume_pages_written)
+    {
+      flush_volume_info->all_pages_written = true;
+    }
+
+#if defined (SERVER_MODE)
+  if (file_sync_helper_can_flush
+      && (*count_writes >= prm_get_integer_value (PRM_ID_PB_SYNC_ON_NFLUSH) || all_volume_pages_written)
+      && dwb_is_file_sync_helper_daemon_available ())
+    {
+      if (ATOMIC_CAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL, block))
+	{
+	  dwb_file_sync_helper_daemon->wakeup ();
+	}
+
+      /* Add statistics. */
+      perfmon_add_stat (thread_p, PSTAT_PB_NUM_IOWRITES, *count_writes);
+      *count_writes = 0;
+    }
+#endif
+
+  return NO_ERROR;
+}
+
 /*
  * dwb_write_block () - Write block pages in specified order.
  *
@@ -2000,7 +2087,8 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
  * remove_from_hash(in): True, if needs to remove entries from hash.
  * file_sync_helper_can_flush(in): True, if helper can flush.
  *
- *  Note: This function fills to_flush_vdes array with the volumes that must be flushed.
+ *  Note: This function fills to_flush_vdes array with the volumes that must be flushed. The pages of a volume are
+ *        handed in batches to the I/O backend, which may keep all of them in flight.
  */
 STATIC_INLINE int
 dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
@@ -2011,12 +2099,16 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   int last_written_vol_fd, vol_fd;
   VPID *vpid;
   int error_code = NO_ERROR;
-  int count_writes = 0, num_pages_to_sync;
+  int count_writes = 0;
   FLUSH_VOLUME_INFO *current_flush_volume_info = NULL;
-  bool can_flush_volume = false;
+  FILEIO_WRITE_REQUEST write_requests[DWB_WRITE_BATCH_MAX_PAGES];
+  int num_write_requests = 0, max_write_requests;
 
   assert (block != NULL && p_dwb_ordered_slots != NULL);
 
+  /* Without a batch I/O backend, pages are written one by one, as the file sync helper expects. */
+  max_write_requests = fileio_is_batch_io_enabled ()? DWB_WRITE_BATCH_MAX_PAGES : 1;
+
   /*
    * Write the whole slots data first and then remove it from hash. Is better to do in this way. Thus, the fileio_write
    * may be slow. While the current transaction has delays caused by fileio_write, the concurrent transaction still
@@ -2026,8 +2118,6 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   assert (block->count_wb_pages < ordered_slots_length);
   assert (block->count_flush_volumes_info == 0);
 
-  num_pages_to_sync = prm_get_integer_value (PRM_ID_PB_SYNC_ON_NFLUSH);
-
   last_written_volid = NULL_VOLID;
   last_written_vol_fd = NULL_VOLDES;
 
@@ -2047,8 +2137,16 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	  if (current_flush_volume_info != NULL)
 	    {
 	      assert_release (current_flush_volume_info->vdes == last_written_vol_fd);
-	      current_flush_volume_info->all_pages_written = true;
-	      can_flush_volume = true;
+
+	      /* Write the remaining pages of previous volume. */
+	      error_code = dwb_write_block_pages (thread_p, block, write_requests, num_write_requests,
+						 current_flush_volume_info, true, file_sync_helper_can_flush,
+						 &count_writes);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
+	      num_write_requests = 0;
 
 	      current_flush_volume_info = NULL;	/* reset */
 	    }
@@ -2066,55 +2164,39 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	  current_flush_volume_info = dwb_add_volume_to_block_flush_area (thread_p, block, last_written_vol_fd);
 	}
 
-      assert (last_written_vol_fd != NULL_VOLDES);
+      assert (last_written_vol_fd != NULL_VOLDES && current_flush_volume_info != NULL);
 
       assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_2 == 0);
       assert (p_dwb_ordered_slots[i].vpid.pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
 	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
 
-      /* Write the data. */
-      if (fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
-			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+      if (num_write_requests == max_write_requests)
 	{
-	  ASSERT_ERROR ();
-	  dwb_log_error ("DWB write page VPID=(%d, %d) LSA=(%lld,%d) with %d error: \n",
-			 vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
-			 (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset, er_errid ());
-	  assert (false);
-	  /* Something wrong happened. */
-	  return ER_FAILED;
-	}
-
-      dwb_log ("dwb_write_block: written page = (%d,%d) LSA=(%lld,%d)\n",
-	       vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
-	       (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset);
-
-#if defined (SERVER_MODE)
-      assert (current_flush_volume_info != NULL);
-
-      ATOMIC_INC_32 (&current_flush_volume_info->num_pages, 1);
-      count_writes++;
-
-      if (file_sync_helper_can_flush && (count_writes >= num_pages_to_sync || can_flush_volume == true)
-	  && dwb_is_file_sync_helper_daemon_available ())
-	{
-	  if (ATOMIC_CAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL, block))
+	  error_code = dwb_write_block_pages (thread_p, block, write_requests, num_write_requests,
+					     current_flush_volume_info, false, file_sync_helper_can_flush,
+					     &count_writes);
+	  if (error_code != NO_ERROR)
 	    {
-	      dwb_file_sync_helper_daemon->wakeup ();
+	      return error_code;
 	    }
-
-	  /* Add statistics. */
-	  perfmon_add_stat (thread_p, PSTAT_PB_NUM_IOWRITES, count_writes);
-	  count_writes = 0;
-	  can_flush_volume = false;
+	  num_write_requests = 0;
 	}
-#endif
+
+      write_requests[num_write_requests].vol_fd = last_written_vol_fd;
+      write_requests[num_write_requests].page_id = vpid->pageid;
+      write_requests[num_write_requests].io_page_p = p_dwb_ordered_slots[i].io_page;
+      num_write_requests++;
     }
 
   /* the last written volume */
   if (current_flush_volume_info != NULL)
     {
-      current_flush_volume_info->all_pages_written = true;
+      error_code = dwb_write_block_pages (thread_p, block, write_requests, num_write_requests,
+					 current_flush_volume_info, true, file_sync_helper_can_flush, &count_writes);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
     }
 
 #if !defined (NDEBUG)
@@ -2193,6 +2275,9 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
   int num_pages;
   unsigned int current_block_to_flush, next_block_to_flush;
   int max_pages_to_sync;
+  int vols_to_sync[DWB_SYNC_BATCH_MAX_VOLUMES];
+  int num_vols_to_sync = 0;
+  bool sync_in_batch;
 #if defined (SERVER_MODE)
   bool flush = false;
   PERF_UTIME_TRACKER time_track_file_sync_helper;
@@ -2346,6 +2431,7 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
     }
 
   max_pages_to_sync = prm_get_integer_value (PRM_ID_PB_SYNC_ON_NFLUSH) / 2;
+  sync_in_batch = fileio_is_batch_io_enabled ();
 
   /* Now, flush only the volumes having pages in current block. */
   for (i = 0; i < block->count_flush_volumes_info; i++)
@@ -2385,11 +2471,27 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
       num_pages = ATOMIC_TAS_32 (&block->flush_volumes_info[i].num_pages, 0);
       assert (num_pages != 0);
 
-      (void) fileio_synchronize (thread_p, block->flush_volumes_info[i].vdes, NULL, FILEIO_SYNC_ONLY);
+      if (!sync_in_batch)
+	{
+	  (void) fileio_synchronize (thread_p, block->flush_volumes_info[i].vdes, NULL, FILEIO_SYNC_ONLY);
+
+	  dwb_log ("dwb_flush_block: Synchronized volume %d\n", block->flush_volumes_info[i].vdes);
+	  continue;
+	}
+
+      if (num_vols_to_sync == DWB_SYNC_BATCH_MAX_VOLUMES)
+	{
+	  (void) fileio_synchronize_batch (thread_p, vols_to_sync, num_vols_to_sync);
+	  num_vols_to_sync = 0;
+	}
+      vols_to_sync[num_vols_to_sync++] = block->flush_volumes_info[i].vdes;
 
-      dwb_log ("dwb_flush_block: Synchronized volume %d\n", block->flush_volumes_info[i].vdes);
+      dwb_log ("dwb_flush_block: Synchronize volume %d\n", block->flush_volumes_info[i].vdes);
     }
 
+  /* The volumes are synchronized together, the I/O backend may overlap them. */
+  (void) fileio_synchronize_batch (thread_p, vols_to_sync, num_vols_to_sync);
+
   /* Allow to file sync helper thread to finish. */
   block->all_pages_written = true;
 
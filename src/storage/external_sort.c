@@ -50,6 +50,9 @@
 #include "server_support.h"
 #include "thread_entry_task.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info and thread_sleep
+#if defined(SERVER_MODE)
+#include "thread_worker_pool.hpp"
+#endif /* SERVER_MODE */
 
 #include <functional>
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
@@ -78,6 +81,12 @@
 /* Expansion Ratio of the dynamic array that keeps the file contents list */
 #define SORT_EXPAND_DYN_ARRAY_RATIO 1.5
 
+/* Lower limit on the number of records of a run that is split between two parallel sort tasks */
+#define SORT_PX_SPLIT_SIZE_MIN (32 * ONE_K)
+
+/* Estimate of the sort buffer space taken by a record and its vector slot, to size the parallel split */
+#define SORT_PX_RECORD_SIZE_ESTIMATE (64 + (int) sizeof (char *))
+
 #define SORT_MAXREC_LENGTH             \
         ((ssize_t)(DB_PAGESIZE - sizeof(SLOTTED_PAGE_HEADER) - sizeof(SLOT)))
 
@@ -126,6 +135,7 @@ struct px_tree_node
   int px_id;			/* node ID */
 #if defined(SERVER_MODE)
   int px_status;		/* node status; access through px_mtx */
+  bool px_claimed;		/* a thread took the node; access through px_mtx */
 #endif				/* SERVER_MODE */
 
   int px_height;		/* tournament tree: node level */
@@ -181,9 +191,12 @@ struct sort_param
   /* support parallelism */
 #if defined(SERVER_MODE)
   pthread_mutex_t px_mtx;	/* px_node status mutex */
+  pthread_cond_t px_cond;	/* signaled when a px_node is done or a task ends */
+  int px_pending_tasks;		/* tasks pushed to sort_Parallel_workers and not ended yet */
 #endif
   int px_height_max;		/* px_node tournament tree max level */
   int px_array_size;		/* px_node array size */
+  long px_split_size_min;	/* a px_node splits a vector of more records than this */
   PX_TREE_NODE *px_array;	/* px_node array */
 };
 
@@ -304,6 +317,12 @@ static void sort_spage_dump (PAGE_PTR pgptr, int rec_p);
 
 static void sort_append (const void *pk0, const void *pk1);
 
+#if defined(SERVER_MODE)
+/* threads sorting the right children of the tournament trees of all sorts */
+static cubthread::entry_workpool *sort_Parallel_workers = NULL;
+static cubthread::system_worker_entry_manager *sort_Parallel_context_manager = NULL;
+#endif /* SERVER_MODE */
+
 /*
  * sort_spage_initialize () - Initialize a slotted page
  *   return: void
@@ -1301,6 +1320,54 @@ sort_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **base, lo
   return result;
 }
 
+/*
+ * sort_initialize_parallel_workers () - Create the worker pool shared by the parallel sorts of the server
+ *   return: void
+ *
+ * Note: The threads of the pool are started on demand. Without the pool, every sort is sequential.
+ */
+void
+sort_initialize_parallel_workers (void)
+{
+#if defined(SERVER_MODE)
+  std::size_t pool_size = cubthread::system_core_count ();
+
+  assert (sort_Parallel_workers == NULL);
+
+  sort_Parallel_context_manager = new cubthread::system_worker_entry_manager (TT_WORKER);
+  sort_Parallel_workers =
+    cubthread::get_manager ()->create_worker_pool (pool_size, 4 * pool_size, "sort_parallel_workers",
+						   sort_Parallel_context_manager, 1, false);
+  if (sort_Parallel_workers == NULL)
+    {
+      delete sort_Parallel_context_manager;
+      sort_Parallel_context_manager = NULL;
+    }
+#endif /* SERVER_MODE */
+}
+
+/*
+ * sort_finalize_parallel_workers () - Destroy the worker pool shared by the parallel sorts of the server
+ *   return: void
+ *
+ * Note: No sort may be running.
+ */
+void
+sort_finalize_parallel_workers (void)
+{
+#if defined(SERVER_MODE)
+  if (sort_Parallel_workers != NULL)
+    {
+      cubthread::get_manager ()->destroy_worker_pool (sort_Parallel_workers);
+    }
+  if (sort_Parallel_context_manager != NULL)
+    {
+      delete sort_Parallel_context_manager;
+      sort_Parallel_context_manager = NULL;
+    }
+#endif /* SERVER_MODE */
+}
+
 /*
  * sort_listfile () - Perform sorting
  *   return:
@@ -1351,13 +1418,13 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
+  PERF_UTIME_TRACKER time_track;
 #if defined(SERVER_MODE)
-  int num_cpus;
+  int px_degree;
   int rv;
 #endif /* SERVER_MODE */
 
@@ -1386,6 +1453,19 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 
       return error;
     }
+
+  rv = pthread_cond_init (&(sort_param->px_cond), NULL);
+  if (rv != 0)
+    {
+      error = ER_CSS_PTHREAD_COND_INIT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+
+      pthread_mutex_destroy (&(sort_param->px_mtx));
+      free_and_init (sort_param);
+
+      return error;
+    }
+  sort_param->px_pending_tasks = 0;
 #endif /* SERVER_MODE */
 
   sort_param->cmp_fn = cmp_fn;
@@ -1406,6 +1486,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
     }
   sort_param->internal_memory = NULL;
   sort_param->px_height_max = sort_param->px_array_size = 0;
+  sort_param->px_split_size_min = 0;
   sort_param->px_array = NULL;
 
   /* initialize temp. overflow file. Real value will be assigned in sort_inphase_sort function, if long size sorting
@@ -1481,23 +1562,24 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->px_height_max = 0;	/* init */
   sort_param->px_array_size = 1;	/* init */
 
-  /* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-
   tde_er_log ("sort_listfile(): tde_encrypted = %d\n", sort_param->tde_encrypted);
 
 #if defined(SERVER_MODE)
-  if (prm_enable_sort_parallel == true)
+  /* the tournament tree has 2^^n leaves; n is the largest that does not exceed the configured degree */
+  px_degree = prm_get_integer_value (PRM_ID_SORT_PARALLEL_DEGREE);
+  while ((2 << sort_param->px_height_max) <= px_degree)
     {
-      /* TODO - calc n, 2^^n get the number of CPUs TODO - fileio_os_sysconf really get #cores instead of #CPUs -
-       * NEED MORE CONSIDERATION */
-      num_cpus = fileio_os_sysconf ();
-
-      sort_param->px_height_max = (int) sqrt ((double) num_cpus);	/* n */
-      sort_param->px_array_size = num_cpus;	/* 2^^n */
-
-      assert_release (sort_param->px_array_size == pow ((double) 2, (double) sort_param->px_height_max));
+      sort_param->px_height_max++;
     }
+  sort_param->px_array_size = 1 << sort_param->px_height_max;
+
+  /* A run that fills the sort buffer is split until each leaf has about half of its share of the buffer; runs
+   * smaller than that, or than SORT_PX_SPLIT_SIZE_MIN records, are not worth the hand-off to another thread. A
+   * larger sort_buffer_size makes larger runs, which are then split among more leaves. */
+  sort_param->px_split_size_min =
+    (long) (((INT64) sort_param->tot_buffers * DB_PAGESIZE) / SORT_PX_RECORD_SIZE_ESTIMATE
+	    / (2 * sort_param->px_array_size));
+  sort_param->px_split_size_min = MAX (sort_param->px_split_size_min, SORT_PX_SPLIT_SIZE_MIN);
 #endif /* SERVER_MODE */
 
   sort_param->px_array = (PX_TREE_NODE *) malloc (sort_param->px_array_size * sizeof (PX_TREE_NODE));
@@ -1516,7 +1598,9 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
    * space that is going to be needed.
    */
 
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
   error = sort_inphase_sort (thread_p, sort_param, get_fn, get_arg, &total_numrecs);
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_SORT_RUN_GENERATION_TIME_COUNTERS);
   if (error != NO_ERROR)
     {
       goto cleanup;
@@ -1538,6 +1622,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 	    }
 	}
 
+      PERF_UTIME_TRACKER_START (thread_p, &time_track);
       if (sort_param->option == SORT_ELIM_DUP)
 	{
 	  error = sort_exphase_merge_elim_dup (thread_p, sort_param);
@@ -1547,6 +1632,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 	  /* SORT_DUP */
 	  error = sort_exphase_merge (thread_p, sort_param);
 	}
+      PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_SORT_MERGE_TIME_COUNTERS);
     }				/* if (sort_param->tot_runs > 1) */
 
 cleanup:
@@ -1696,19 +1782,51 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 
 #if defined(SERVER_MODE)
 // *INDENT-OFF*
+/*
+ * px_sort_myself_execute() - sort a right child on a worker thread
+ *   return:
+ *   thread_ref(in):
+ *   px_node(in):
+ *
+ * NOTE: the node is skipped if its parent got to it first and sorted it itself.
+ */
 static void
 px_sort_myself_execute (cubthread::entry &thread_ref, PX_TREE_NODE * px_node)
 {
-  (void) px_sort_myself (&thread_ref, px_node);
+  SORT_PARAM *sort_param = (SORT_PARAM *) (px_node->px_arg);
+  bool is_claimed = false;
+
+  pthread_mutex_lock (&(sort_param->px_mtx));
+  if (!px_node->px_claimed)
+    {
+      px_node->px_claimed = true;
+      is_claimed = true;
+    }
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  if (is_claimed)
+    {
+      /* sort on behalf of the transaction of the sort */
+      thread_ref.tran_index = px_node->px_tran_index;
+      (void) px_sort_myself (&thread_ref, px_node);
+      thread_ref.tran_index = LOG_SYSTEM_TRAN_INDEX;
+    }
+
+  pthread_mutex_lock (&(sort_param->px_mtx));
+  sort_param->px_pending_tasks--;
+  pthread_cond_broadcast (&(sort_param->px_cond));
+  pthread_mutex_unlock (&(sort_param->px_mtx));
 }
 
 /*
  * px_sort_communicate() -
- *   return:
+ *   return: NO_ERROR, or ER_FAILED if no worker thread is available
  *   thread_p(in):
  *   px_node(in):
  *
  * NOTE: support parallelism
+ *       The node is pushed to the worker pool shared by all sorts. When no worker is available, the node is left to
+ *       its parent.
  */
 static int
 px_sort_communicate (PX_TREE_NODE * px_node)
@@ -1723,9 +1841,20 @@ px_sort_communicate (PX_TREE_NODE * px_node)
   assert_release (px_node->px_id < sort_param->px_array_size);
   assert_release (px_node->px_vector_size > 1);
 
+  if (sort_Parallel_workers == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  pthread_mutex_lock (&(sort_param->px_mtx));
+  sort_param->px_pending_tasks++;
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  perfmon_inc_stat (thread_get_thread_entry_info (), PSTAT_SORT_NUM_PARALLEL_TASKS);
+
   cubthread::entry_callable_task *task =
     new cubthread::entry_callable_task (std::bind (px_sort_myself_execute, std::placeholders::_1, px_node));
-  css_push_external_task (css_get_current_conn_entry (), task);
+  cubthread::get_manager ()->push_task (sort_Parallel_workers, task);
 
   return NO_ERROR;
 }
@@ -1751,8 +1880,6 @@ px_sort_communicate (PX_TREE_NODE * px_node)
 static int
 px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
-#define SORT_PARTITION_RUN_SIZE_MIN (ONE_M)
-
   int ret = NO_ERROR;
   bool old_check_interrupt;
 
@@ -1787,13 +1914,6 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
   sort_param = (SORT_PARAM *) (px_node->px_arg);
 
 #if defined(SERVER_MODE)
-  if (px_node->px_id > 0)
-    {
-      /* is new childs */
-      thread_p->tran_index = px_node->px_tran_index;
-      pthread_mutex_unlock (&thread_p->tran_index_lock);
-    }
-
 #if !defined(NDEBUG)
   rv = pthread_mutex_lock (&(sort_param->px_mtx));
   assert (rv == NO_ERROR);
@@ -1842,13 +1962,14 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
       assert_release (px_node->px_status == 0);
       px_node->px_status = 1;	/* done */
+      pthread_cond_broadcast (&(sort_param->px_cond));
 
       pthread_mutex_unlock (&(sort_param->px_mtx));
 
       goto exit_on_end;
     }
 
-  if (px_node->px_height > 0 && vector_size > SORT_PARTITION_RUN_SIZE_MIN)
+  if (px_node->px_height > 0 && vector_size > sort_param->px_split_size_min)
     {
       long left_vector_size, right_vector_size;
       char **left_vector, **right_vector;
@@ -1873,11 +1994,8 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
       if (right_vector_size > 1)
 	{
-	  /* launch new worker */
-	  if (px_sort_communicate (right_px_node) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
+	  /* launch new worker; without one, the right side is sorted below after the left side */
+	  (void) px_sort_communicate (right_px_node);
 	}
       else
 	{
@@ -1887,6 +2005,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 	  assert (rv == NO_ERROR);
 
 	  assert_release (right_px_node->px_status == 0);
+	  right_px_node->px_claimed = true;
 	  right_px_node->px_status = 1;	/* done */
 
 	  pthread_mutex_unlock (&(sort_param->px_mtx));
@@ -1919,23 +2038,33 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 	    }
 	}
 
-      /* wait for right-child finished */
-      do
+      /* wait for right-child finished; if no worker took it yet, sort it here, so that a parent never waits for a
+       * task queued behind busy workers */
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      assert (rv == NO_ERROR);
+
+      if (!right_px_node->px_claimed)
 	{
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
+	  right_px_node->px_claimed = true;
+	  pthread_mutex_unlock (&(sort_param->px_mtx));
 
-	  if (right_px_node->px_status != 0)
+	  (void) px_sort_myself (thread_p, right_px_node);
+	}
+      else
+	{
+	  while (right_px_node->px_status == 0)
 	    {
-	      assert (right_px_node->px_status == 1);
-	      pthread_mutex_unlock (&(sort_param->px_mtx));
-	      break;
+	      pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
 	    }
-
 	  pthread_mutex_unlock (&(sort_param->px_mtx));
-	  thread_sleep (10);	/* 10 msec */
 	}
-      while (1);
+
+#if !defined(NDEBUG)
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      assert (rv == NO_ERROR);
+      assert (right_px_node->px_status == 1);
+      pthread_mutex_unlock (&(sort_param->px_mtx));
+#endif
 
       assert_release (px_node == left_px_node);
 #if !defined(NDEBUG)
@@ -2125,6 +2254,7 @@ exit_on_end:
 
       assert_release (px_node->px_status == 0);
       px_node->px_status = 1;	/* done */
+      pthread_cond_broadcast (&(sort_param->px_cond));
 
       pthread_mutex_unlock (&(sort_param->px_mtx));
     }
@@ -2270,9 +2400,16 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 		  rv = pthread_mutex_lock (&(sort_param->px_mtx));
 		  assert (rv == NO_ERROR);
 
+		  /* tasks of the previous run that were left to their parent may not have ended yet */
+		  while (sort_param->px_pending_tasks > 0)
+		    {
+		      pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+		    }
+
 		  for (i = 0; i < sort_param->px_array_size; i++)
 		    {
 		      sort_param->px_array[i].px_status = 0;	/* init */
+		      sort_param->px_array[i].px_claimed = false;
 		    }
 
 		  pthread_mutex_unlock (&(sort_param->px_mtx));
@@ -2525,9 +2662,16 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
 	  assert (rv == NO_ERROR);
 
+	  /* tasks of the previous run that were left to their parent may not have ended yet */
+	  while (sort_param->px_pending_tasks > 0)
+	    {
+	      pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+	    }
+
 	  for (i = 0; i < sort_param->px_array_size; i++)
 	    {
 	      sort_param->px_array[i].px_status = 0;	/* init */
+	      sort_param->px_array[i].px_claimed = false;
 	    }
 
 	  pthread_mutex_unlock (&(sort_param->px_mtx));
@@ -4446,6 +4590,16 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 	}
     }
 
+#if defined(SERVER_MODE)
+  /* the tasks reference the px_node array */
+  pthread_mutex_lock (&(sort_param->px_mtx));
+  while (sort_param->px_pending_tasks > 0)
+    {
+      pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+    }
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+#endif /* SERVER_MODE */
+
   if (sort_param->px_array)
     {
       free_and_init (sort_param->px_array);
@@ -4458,6 +4612,7 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_DESTROY, 0);
     }
+  (void) pthread_cond_destroy (&(sort_param->px_cond));
 #endif
 
   free_and_init (sort_param);
@@ -4611,6 +4766,7 @@ sort_read_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_
   INT32 page_no;
   int i;
   int ret = NO_ERROR;
+  bool is_copied;
 
   vpid.volid = vfid->volid;
   page_no = first_page;
@@ -4627,7 +4783,12 @@ sort_read_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_
 	  ASSERT_ERROR ();
 	  return ret;
 	}
-      if (pgbuf_copy_to_area (thread_p, &vpid, 0, DB_PAGESIZE, page_ptr, true) == NULL)
+
+      /* run pages are read only once; do not let them evict other pages from buffer */
+      pgbuf_bulk_read_begin (thread_p);
+      is_copied = pgbuf_copy_to_area (thread_p, &vpid, 0, DB_PAGESIZE, page_ptr, true) != NULL;
+      pgbuf_bulk_read_end (thread_p);
+      if (!is_copied)
 	{
 	  ASSERT_ERROR_AND_SET (ret);
 	  return ret;
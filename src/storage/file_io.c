@@ -65,6 +65,20 @@
 #include <aio.h>
 #endif /* HPUX */
 
+#if defined (O_DIRECT) && !defined (WINDOWS) && !defined (CS_MODE)
+#define FILEIO_HAVE_DIRECT_IO
+#endif /* O_DIRECT && !WINDOWS && !CS_MODE */
+
+#if defined (HAVE_LINUX_IO_URING_H) && !defined (CS_MODE)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include <mutex>
+#if defined (__NR_io_uring_setup) && defined (__NR_io_uring_enter)
+#define FILEIO_HAVE_IO_URING
+#endif
+#endif /* HAVE_LINUX_IO_URING_H && !CS_MODE */
+
 #include "porting.h"
 
 #include "chartype.h"
@@ -259,6 +273,13 @@
 
 #define FILEIO_END_OF_FILE                (1)
 
+#if defined (FILEIO_HAVE_DIRECT_IO)
+/* Direct I/O cannot use the buffer as is, the transfer goes through an aligned copy. */
+#define FILEIO_NEEDS_ALIGNED_COPY(buf) \
+  (prm_get_bool_value (PRM_ID_DATA_VOLUME_DIRECT_IO) \
+   && (((UINTPTR) (buf)) & (FILEIO_DIRECT_IO_ALIGNMENT - 1)) != 0)
+#endif /* FILEIO_HAVE_DIRECT_IO */
+
 /* Minimum flush rate 40MB/s */
 #define FILEIO_MIN_FLUSH_PAGES_PER_SEC    (41943040 / IO_PAGESIZE)
 /* TODO: Growth/drop flush rate values can be tweaked. They have been set to
@@ -454,6 +475,86 @@ static TOKEN_BUCKET fc_Token_bucket_s;
 static TOKEN_BUCKET *fc_Token_bucket = NULL;
 static FLUSH_STATS fc_Stats;
 
+#if !defined (CS_MODE)
+/*
+ * I/O backend used for batched page writes and volume synchronization. The synchronous backend issues one system
+ * call per page; the io_uring backend keeps the whole batch in flight and reaps the completions together.
+ */
+typedef struct fileio_io_backend FILEIO_IO_BACKEND;
+struct fileio_io_backend
+{
+  const char *name;
+  int (*write_batch) (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests, size_t page_size,
+		      FILEIO_WRITE_MODE write_mode);
+  int (*synchronize_batch) (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols);
+};
+
+static int fileio_sync_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests,
+				    size_t page_size, FILEIO_WRITE_MODE write_mode);
+static int fileio_sync_synchronize_batch (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols);
+
+static FILEIO_IO_BACKEND fileio_Sync_io_backend = {
+  "sync", fileio_sync_write_batch, fileio_sync_synchronize_batch
+};
+
+#if defined (FILEIO_HAVE_IO_URING)
+/* Rings are shared by the threads doing batched I/O, each thread maps to a ring by its index. */
+#define FILEIO_URING_MAX_RINGS 8
+
+typedef struct fileio_uring FILEIO_URING;
+struct fileio_uring
+{
+  std::mutex mutex;		/* a ring has a single submitter at a time */
+  bool is_initialized;
+  int ring_fd;
+  unsigned int sq_entries;
+  unsigned int cq_entries;
+
+  void *sq_ring_p;
+  size_t sq_ring_size;
+  void *cq_ring_p;
+  size_t cq_ring_size;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+
+  unsigned int *sq_head;
+  unsigned int *sq_tail;
+  unsigned int *sq_ring_mask;
+  unsigned int *sq_array;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  unsigned int *cq_ring_mask;
+  struct io_uring_cqe *cqes;
+};
+
+/* prepares the submission entry of operation index, for write or fsync batches */
+typedef void (*FILEIO_URING_PREP_FUNC) (struct io_uring_sqe * sqe, int index, void *arg);
+/* handles the completion of operation index, returns error code */
+typedef int (*FILEIO_URING_COMPLETE_FUNC) (THREAD_ENTRY * thread_p, int index, int result, void *arg);
+
+typedef struct fileio_uring_write_arg FILEIO_URING_WRITE_ARG;
+struct fileio_uring_write_arg
+{
+  FILEIO_WRITE_REQUEST *requests;
+  size_t page_size;
+  FILEIO_WRITE_MODE write_mode;
+  int num_written;		/* pages written by the ring */
+};
+
+static int fileio_uring_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests,
+				     size_t page_size, FILEIO_WRITE_MODE write_mode);
+static int fileio_uring_synchronize_batch (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols);
+
+static FILEIO_IO_BACKEND fileio_Uring_io_backend = {
+  "io_uring", fileio_uring_write_batch, fileio_uring_synchronize_batch
+};
+
+static FILEIO_URING fileio_Uring_rings[FILEIO_URING_MAX_RINGS];
+/* set when io_uring cannot be used in this process (no kernel support, not permitted...) */
+static volatile bool fileio_Uring_disabled = false;
+#endif /* FILEIO_HAVE_IO_URING */
+#endif /* !CS_MODE */
+
 #if defined(CUBRID_DEBUG)
 /* Set this to get various levels of io information regarding
  * backup and restore activity.
@@ -512,11 +613,38 @@ static bool fileio_is_terminated_process (int pid);
 
 static ssize_t fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
 static ssize_t fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+static ssize_t fileio_os_read_aligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count,
+				       off_t offset);
+static ssize_t fileio_os_write_aligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count,
+					off_t offset);
+#endif /* FILEIO_HAVE_DIRECT_IO */
+#if !defined (WINDOWS)
+static int fileio_open_volume (const char *vol_label_p, VOLID vol_id, int flags, int mode);
+#endif /* !WINDOWS */
 #if !defined (WINDOWS)
 static ssize_t pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count,
 					   off_t offset);
 #endif
 
+#if !defined (CS_MODE)
+static FILEIO_IO_BACKEND *fileio_get_io_backend (void);
+#if defined (FILEIO_HAVE_IO_URING)
+static FILEIO_URING *fileio_uring_acquire (THREAD_ENTRY * thread_p);
+static void fileio_uring_release (FILEIO_URING * ring);
+static int fileio_uring_create (FILEIO_URING * ring, unsigned int entries);
+static void fileio_uring_destroy (FILEIO_URING * ring);
+static void fileio_uring_disable (FILEIO_URING * ring, int os_error);
+static int fileio_uring_execute (THREAD_ENTRY * thread_p, FILEIO_URING * ring, int num_ops,
+				 FILEIO_URING_PREP_FUNC prep_func, FILEIO_URING_COMPLETE_FUNC complete_func, void *arg,
+				 bool * is_ring_failed);
+static void fileio_uring_prep_write (struct io_uring_sqe *sqe, int index, void *arg);
+static int fileio_uring_complete_write (THREAD_ENTRY * thread_p, int index, int result, void *arg);
+static void fileio_uring_prep_fsync (struct io_uring_sqe *sqe, int index, void *arg);
+static int fileio_uring_complete_fsync (THREAD_ENTRY * thread_p, int index, int result, void *arg);
+#endif /* FILEIO_HAVE_IO_URING */
+#endif /* !CS_MODE */
+
 #if !defined(WINDOWS)
 static FILEIO_LOCKF_TYPE fileio_lock (const char *db_fullname, const char *vlabel, int vdes, bool dowait);
 static void fileio_unlock (const char *vlabel, int vdes, FILEIO_LOCKF_TYPE lockf_type);
@@ -1958,6 +2086,42 @@ fileio_open (const char *vol_label_p, int flags, int mode)
   return vol_fd;
 }
 
+#if !defined (WINDOWS)
+/*
+ * fileio_open_volume () - Open a database volume, using direct I/O for data volumes if configured
+ *   return: volume descriptor identifier on success, NULL_VOLDES on failure
+ *   vlabel(in): Volume label
+ *   vol_id(in): Volume identifier
+ *   flags(in): open the volume as specified by the flags
+ *   mode(in): used when the volume is created
+ *
+ * Note: Direct I/O bypasses the OS page cache, so the data pages are cached only by the page buffer. Log, DWB and
+ *       other system volumes are always opened buffered.
+ */
+static int
+fileio_open_volume (const char *vol_label_p, VOLID vol_id, int flags, int mode)
+{
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  int vol_fd;
+
+  if (vol_id >= LOG_DBFIRST_VOLID && prm_get_bool_value (PRM_ID_DATA_VOLUME_DIRECT_IO))
+    {
+      vol_fd = fileio_open (vol_label_p, flags | O_DIRECT, mode);
+      if (vol_fd != NULL_VOLDES || errno != EINVAL)
+	{
+	  return vol_fd;
+	}
+
+      /* The file system does not support direct I/O. */
+      er_log_debug (ARG_FILE_LINE, "Volume %s is opened without direct I/O, the file system does not support it.",
+		    vol_label_p);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+
+  return fileio_open (vol_label_p, flags, mode);
+}
+#endif /* !WINDOWS */
+
 #if !defined(WINDOWS)
 /*
  * fileio_set_permission () -
@@ -2126,7 +2290,7 @@ fileio_create (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *
 	}
     }
 
-  vol_fd = fileio_open (vol_label_p, FILEIO_DISK_FORMAT_MODE | o_sync, FILEIO_DISK_PROTECTION_MODE);
+  vol_fd = fileio_open_volume (vol_label_p, vol_id, FILEIO_DISK_FORMAT_MODE | o_sync, FILEIO_DISK_PROTECTION_MODE);
   if (vol_fd == NULL_VOLDES)
     {
       er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_FORMAT_FAIL, 3, vol_label_p, -1, -1LL);
@@ -2976,7 +3140,7 @@ fileio_mount (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *v
 
   /* OPEN THE DISK VOLUME PARTITION OR FILE SIMULATED VOLUME */
 start:
-  vol_fd = fileio_open (vol_label_p, O_RDWR | o_sync, 0600);
+  vol_fd = fileio_open_volume (vol_label_p, vol_id, O_RDWR | o_sync, 0600);
   if (vol_fd == NULL_VOLDES)
     {
       er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_MOUNT_FAIL, 1, vol_label_p);
@@ -3399,6 +3563,10 @@ fileio_dismount_all (THREAD_ENTRY * thread_p)
   free_and_init (vol_header_p->volinfo);
 
   pthread_mutex_unlock (&vol_header_p->mutex);
+
+#if !defined (CS_MODE)
+  fileio_finalize_io_backend ();
+#endif /* !CS_MODE */
 }
 
 /*
@@ -3836,6 +4004,13 @@ fileio_get_volume_mutex (THREAD_ENTRY * thread_p, int vdes)
 static ssize_t
 fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (FILEIO_NEEDS_ALIGNED_COPY (io_page_p))
+    {
+      return fileio_os_read_aligned (thread_p, vol_fd, io_page_p, count, offset);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+
 #if !defined (SERVER_MODE)
   /* Locate the desired page */
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
@@ -3886,6 +4061,75 @@ fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t cou
 #endif
 }
 
+#if defined (FILEIO_HAVE_DIRECT_IO)
+/*
+ * fileio_os_read_aligned () - fileio_os_read through an aligned copy of the buffer
+ *   return: the number of bytes read is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(out): Address where content of page is stored. Must be of page_size long
+ *   count(in): the number of bytes to be read
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_os_read_aligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+  void *aligned_p;
+  ssize_t nbytes;
+  int saved_errno;
+
+  aligned_p = fileio_alloc_aligned (count);
+  if (aligned_p == NULL)
+    {
+      errno = ENOMEM;
+      return ER_FAILED;
+    }
+
+  nbytes = fileio_os_read (thread_p, vol_fd, aligned_p, count, offset);
+  saved_errno = errno;
+  if (nbytes > 0)
+    {
+      memcpy (io_page_p, aligned_p, (size_t) nbytes);
+    }
+
+  fileio_free_aligned (aligned_p);
+  errno = saved_errno;
+
+  return nbytes;
+}
+
+/*
+ * fileio_os_write_aligned () - fileio_os_write through an aligned copy of the buffer
+ *   return: the number of bytes written is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in): In-memory address where the current content of page resides
+ *   count(in): the number of bytes to be written
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_os_write_aligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+  void *aligned_p;
+  ssize_t nbytes;
+  int saved_errno;
+
+  aligned_p = fileio_alloc_aligned (count);
+  if (aligned_p == NULL)
+    {
+      errno = ENOMEM;
+      return ER_FAILED;
+    }
+
+  memcpy (aligned_p, io_page_p, count);
+  nbytes = fileio_os_write (thread_p, vol_fd, aligned_p, count, offset);
+  saved_errno = errno;
+
+  fileio_free_aligned (aligned_p);
+  errno = saved_errno;
+
+  return nbytes;
+}
+#endif /* FILEIO_HAVE_DIRECT_IO */
+
 /*
  * fileio_read () - READ A PAGE FROM DISK
  *   return:
@@ -4037,6 +4281,13 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
 static ssize_t
 fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (FILEIO_NEEDS_ALIGNED_COPY (io_page_p))
+    {
+      return fileio_os_write_aligned (thread_p, vol_fd, io_page_p, count, offset);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+
 #if !defined (SERVER_MODE)
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
     {
@@ -4470,6 +4721,678 @@ fileio_synchronize (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, FIL
     }
 }
 
+/*
+ * fileio_alloc_aligned () - Allocate memory aligned for direct I/O
+ *   return: allocated memory or NULL
+ *   size(in): size in bytes
+ *
+ * Note: Buffers used to read or write data volume pages must be allocated with this function, otherwise direct I/O
+ *       copies them to an aligned buffer first. Free the memory with fileio_free_aligned.
+ */
+void *
+fileio_alloc_aligned (size_t size)
+{
+  void *ptr = NULL;
+
+#if defined (WINDOWS)
+  ptr = _aligned_malloc (size, FILEIO_DIRECT_IO_ALIGNMENT);
+#else /* WINDOWS */
+  if (posix_memalign (&ptr, FILEIO_DIRECT_IO_ALIGNMENT, size) != 0)
+    {
+      ptr = NULL;
+    }
+#endif /* WINDOWS */
+
+  return ptr;
+}
+
+/*
+ * fileio_free_aligned () - Free memory allocated by fileio_alloc_aligned
+ *   return: void
+ *   ptr(in): memory to free
+ */
+void
+fileio_free_aligned (void *ptr)
+{
+  if (ptr == NULL)
+    {
+      return;
+    }
+
+#if defined (WINDOWS)
+  _aligned_free (ptr);
+#else /* WINDOWS */
+  /* the memory was not allocated through the memory monitor wrapper */
+  (free) (ptr);
+#endif /* WINDOWS */
+}
+
+#if !defined (CS_MODE)
+/*
+ * fileio_write_batch () - Write a batch of pages to disk
+ *   return: error code
+ *   requests(in): The page writes
+ *   num_requests(in): Number of page writes
+ *   page_size(in): Page size
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ *
+ * Note: The pages are written by the configured I/O backend. With io_uring the whole batch is kept in flight and the
+ *       completions are reaped together. The function returns when every page was written or an error occurred.
+ */
+int
+fileio_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests, size_t page_size,
+		    FILEIO_WRITE_MODE write_mode)
+{
+  assert (requests != NULL || num_requests == 0);
+
+  if (num_requests <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  return fileio_get_io_backend ()->write_batch (thread_p, requests, num_requests, page_size, write_mode);
+}
+
+/*
+ * fileio_synchronize_batch () - Synchronize a set of database volumes with disk
+ *   return: error code
+ *   vol_fds(in): Volume descriptors
+ *   num_vols(in): Number of volumes
+ *
+ * Note: Unlike fileio_synchronize, DWB is never flushed. With io_uring, the volumes are synchronized concurrently.
+ */
+int
+fileio_synchronize_batch (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols)
+{
+  assert (vol_fds != NULL || num_vols == 0);
+
+  if (num_vols <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (num_vols == 1 || prm_get_integer_value (PRM_ID_SUPPRESS_FSYNC) > 0)
+    {
+      /* nothing to overlap, or fsync is suppressed by fileio_synchronize */
+      return fileio_sync_synchronize_batch (thread_p, vol_fds, num_vols);
+    }
+
+  return fileio_get_io_backend ()->synchronize_batch (thread_p, vol_fds, num_vols);
+}
+
+/*
+ * fileio_is_batch_io_enabled () - Is a batch I/O backend in use?
+ *   return: true if batched writes and syncs may be kept in flight, false if they are done one by one
+ */
+bool
+fileio_is_batch_io_enabled (void)
+{
+  return fileio_get_io_backend () != &fileio_Sync_io_backend;
+}
+
+/*
+ * fileio_finalize_io_backend () - Release the resources of the I/O backend
+ *   return: void
+ */
+void
+fileio_finalize_io_backend (void)
+{
+#if defined (FILEIO_HAVE_IO_URING)
+  int i;
+
+  for (i = 0; i < FILEIO_URING_MAX_RINGS; i++)
+    {
+      std::lock_guard < std::mutex > ring_guard (fileio_Uring_rings[i].mutex);
+      fileio_uring_destroy (&fileio_Uring_rings[i]);
+    }
+#endif /* FILEIO_HAVE_IO_URING */
+}
+
+/*
+ * fileio_get_io_backend () - Get the I/O backend for batched writes and synchronization
+ *   return: I/O backend
+ */
+static FILEIO_IO_BACKEND *
+fileio_get_io_backend (void)
+{
+#if defined (FILEIO_HAVE_IO_URING)
+#if defined (SERVER_MODE) && !defined (NDEBUG)
+  if (FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS1) || FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS2))
+    {
+      /* partial writes are injected on synchronous path only */
+      return &fileio_Sync_io_backend;
+    }
+#endif
+
+  if (!fileio_Uring_disabled && prm_get_integer_value (PRM_ID_IO_URING_QUEUE_DEPTH) > 0)
+    {
+      return &fileio_Uring_io_backend;
+    }
+#endif /* FILEIO_HAVE_IO_URING */
+
+  return &fileio_Sync_io_backend;
+}
+
+/*
+ * fileio_sync_write_batch () - Write the batch of pages one by one
+ *   return: error code
+ *   requests(in): The page writes
+ *   num_requests(in): Number of page writes
+ *   page_size(in): Page size
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ */
+static int
+fileio_sync_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests, size_t page_size,
+			 FILEIO_WRITE_MODE write_mode)
+{
+  int i;
+  int error_code = NO_ERROR;
+
+  for (i = 0; i < num_requests; i++)
+    {
+      if (fileio_write (thread_p, requests[i].vol_fd, requests[i].io_page_p, requests[i].page_id, page_size,
+			write_mode) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_sync_synchronize_batch () - Synchronize the volumes one by one
+ *   return: error code
+ *   vol_fds(in): Volume descriptors
+ *   num_vols(in): Number of volumes
+ */
+static int
+fileio_sync_synchronize_batch (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols)
+{
+  int i;
+  int error_code = NO_ERROR;
+
+  for (i = 0; i < num_vols; i++)
+    {
+      if (fileio_synchronize (thread_p, vol_fds[i], fileio_get_volume_label_by_fd (vol_fds[i], PEEK),
+			      FILEIO_SYNC_ONLY) != vol_fds[i])
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+#if defined (FILEIO_HAVE_IO_URING)
+/*
+ * fileio_uring_write_batch () - Write the batch of pages through io_uring
+ *   return: error code
+ *   requests(in): The page writes
+ *   num_requests(in): Number of page writes
+ *   page_size(in): Page size
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ */
+static int
+fileio_uring_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests,
+			  size_t page_size, FILEIO_WRITE_MODE write_mode)
+{
+  FILEIO_URING *ring;
+  FILEIO_URING_WRITE_ARG write_arg;
+  bool is_ring_failed = false;
+  int error_code;
+
+  ring = fileio_uring_acquire (thread_p);
+  if (ring == NULL)
+    {
+      return fileio_sync_write_batch (thread_p, requests, num_requests, page_size, write_mode);
+    }
+
+  write_arg.requests = requests;
+  write_arg.page_size = page_size;
+  write_arg.write_mode = write_mode;
+  write_arg.num_written = 0;
+
+  error_code = fileio_uring_execute (thread_p, ring, num_requests, fileio_uring_prep_write,
+				     fileio_uring_complete_write, &write_arg, &is_ring_failed);
+  fileio_uring_release (ring);
+
+  perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOWRITES, write_arg.num_written);
+
+  if (is_ring_failed)
+    {
+      /* we cannot tell which pages were written. writing a page twice is harmless. */
+      return fileio_sync_write_batch (thread_p, requests, num_requests, page_size, write_mode);
+    }
+
+  return error_code;
+}
+
+/*
+ * fileio_uring_synchronize_batch () - Synchronize the volumes through io_uring
+ *   return: error code
+ *   vol_fds(in): Volume descriptors
+ *   num_vols(in): Number of volumes
+ */
+static int
+fileio_uring_synchronize_batch (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols)
+{
+  FILEIO_URING *ring;
+  bool is_ring_failed = false;
+  int error_code;
+
+  ring = fileio_uring_acquire (thread_p);
+  if (ring == NULL)
+    {
+      return fileio_sync_synchronize_batch (thread_p, vol_fds, num_vols);
+    }
+
+  error_code = fileio_uring_execute (thread_p, ring, num_vols, fileio_uring_prep_fsync, fileio_uring_complete_fsync,
+				     (void *) vol_fds, &is_ring_failed);
+  fileio_uring_release (ring);
+
+  if (is_ring_failed)
+    {
+      return fileio_sync_synchronize_batch (thread_p, vol_fds, num_vols);
+    }
+
+  return error_code;
+}
+
+/*
+ * fileio_uring_acquire () - Get exclusive use of the ring of current thread
+ *   return: ring or NULL if io_uring cannot be used
+ */
+static FILEIO_URING *
+fileio_uring_acquire (THREAD_ENTRY * thread_p)
+{
+  FILEIO_URING *ring;
+  int ring_index = 0;
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  ring_index = thread_p->index % FILEIO_URING_MAX_RINGS;
+#endif /* SERVER_MODE */
+
+  ring = &fileio_Uring_rings[ring_index];
+  ring->mutex.lock ();
+
+  if (!ring->is_initialized)
+    {
+      if (fileio_Uring_disabled
+	  || fileio_uring_create (ring, (unsigned int) prm_get_integer_value (PRM_ID_IO_URING_QUEUE_DEPTH)) != NO_ERROR)
+	{
+	  ring->mutex.unlock ();
+	  return NULL;
+	}
+    }
+
+  return ring;
+}
+
+/*
+ * fileio_uring_release () - Release the ring acquired by fileio_uring_acquire
+ *   return: void
+ */
+static void
+fileio_uring_release (FILEIO_URING * ring)
+{
+  ring->mutex.unlock ();
+}
+
+/*
+ * fileio_uring_create () - Set up the ring and map its queues
+ *   return: error code
+ *   ring(in/out): Ring
+ *   entries(in): Submission queue size
+ */
+static int
+fileio_uring_create (FILEIO_URING * ring, unsigned int entries)
+{
+  struct io_uring_params params;
+  int ring_fd;
+  int os_error;
+
+  assert (!ring->is_initialized);
+
+  memset (&params, 0, sizeof (params));
+  ring_fd = (int) syscall (__NR_io_uring_setup, entries, &params);
+  if (ring_fd < 0)
+    {
+      fileio_uring_disable (ring, errno);
+      return ER_FAILED;
+    }
+
+  ring->ring_fd = ring_fd;
+  ring->is_initialized = true;
+  ring->sq_ring_p = ring->cq_ring_p = NULL;
+  ring->sqes = NULL;
+
+  ring->sq_entries = params.sq_entries;
+  ring->cq_entries = params.cq_entries;
+  ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned int);
+  ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof (struct io_uring_cqe);
+  ring->sqes_size = params.sq_entries * sizeof (struct io_uring_sqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      /* both queues are mapped with one call */
+      ring->sq_ring_size = ring->cq_ring_size = MAX (ring->sq_ring_size, ring->cq_ring_size);
+    }
+
+  ring->sq_ring_p = mmap (NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+			  IORING_OFF_SQ_RING);
+  if (ring->sq_ring_p == MAP_FAILED)
+    {
+      ring->sq_ring_p = NULL;
+      goto error;
+    }
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      ring->cq_ring_p = ring->sq_ring_p;
+    }
+  else
+    {
+      ring->cq_ring_p = mmap (NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+			      IORING_OFF_CQ_RING);
+      if (ring->cq_ring_p == MAP_FAILED)
+	{
+	  ring->cq_ring_p = NULL;
+	  goto error;
+	}
+    }
+
+  ring->sqes = (struct io_uring_sqe *) mmap (NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+					     MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+  if (ring->sqes == MAP_FAILED)
+    {
+      ring->sqes = NULL;
+      goto error;
+    }
+
+  ring->sq_head = (unsigned int *) ((char *) ring->sq_ring_p + params.sq_off.head);
+  ring->sq_tail = (unsigned int *) ((char *) ring->sq_ring_p + params.sq_off.tail);
+  ring->sq_ring_mask = (unsigned int *) ((char *) ring->sq_ring_p + params.sq_off.ring_mask);
+  ring->sq_array = (unsigned int *) ((char *) ring->sq_ring_p + params.sq_off.array);
+  ring->cq_head = (unsigned int *) ((char *) ring->cq_ring_p + params.cq_off.head);
+  ring->cq_tail = (unsigned int *) ((char *) ring->cq_ring_p + params.cq_off.tail);
+  ring->cq_ring_mask = (unsigned int *) ((char *) ring->cq_ring_p + params.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *) ((char *) ring->cq_ring_p + params.cq_off.cqes);
+
+  return NO_ERROR;
+
+error:
+  os_error = errno;
+  fileio_uring_disable (ring, os_error);
+  return ER_FAILED;
+}
+
+/*
+ * fileio_uring_destroy () - Unmap the queues and close the ring
+ *   return: void
+ *   ring(in/out): Ring
+ */
+static void
+fileio_uring_destroy (FILEIO_URING * ring)
+{
+  if (!ring->is_initialized)
+    {
+      return;
+    }
+
+  if (ring->sqes != NULL)
+    {
+      munmap (ring->sqes, ring->sqes_size);
+      ring->sqes = NULL;
+    }
+  if (ring->cq_ring_p != NULL && ring->cq_ring_p != ring->sq_ring_p)
+    {
+      munmap (ring->cq_ring_p, ring->cq_ring_size);
+    }
+  ring->cq_ring_p = NULL;
+  if (ring->sq_ring_p != NULL)
+    {
+      munmap (ring->sq_ring_p, ring->sq_ring_size);
+      ring->sq_ring_p = NULL;
+    }
+
+  close (ring->ring_fd);
+  ring->ring_fd = NULL_VOLDES;
+  ring->is_initialized = false;
+}
+
+/*
+ * fileio_uring_disable () - Stop using io_uring, I/O falls back to synchronous backend
+ *   return: void
+ *   ring(in/out): Ring that failed
+ *   os_error(in): Error reported by the kernel
+ */
+static void
+fileio_uring_disable (FILEIO_URING * ring, int os_error)
+{
+  fileio_uring_destroy (ring);
+
+  if (!fileio_Uring_disabled)
+    {
+      fileio_Uring_disabled = true;
+      er_log_debug (ARG_FILE_LINE, "io_uring cannot be used (errno = %d). Falling back to synchronous I/O.", os_error);
+    }
+}
+
+/*
+ * fileio_uring_execute () - Run a batch of operations through the ring
+ *   return: error code of first failed operation
+ *   ring(in): Acquired ring
+ *   num_ops(in): Number of operations
+ *   prep_func(in): Fills the submission entry of an operation
+ *   complete_func(in): Handles the completion of an operation
+ *   arg(in): Argument of prep_func and complete_func
+ *   is_ring_failed(out): True if the ring became unusable. The caller must redo the operations without ring.
+ *
+ * Note: As many operations as the ring can hold are kept in flight. One system call both submits new operations and
+ *       waits for completions. All submitted operations are completed when the function returns, unless the ring
+ *       failed.
+ */
+static int
+fileio_uring_execute (THREAD_ENTRY * thread_p, FILEIO_URING * ring, int num_ops, FILEIO_URING_PREP_FUNC prep_func,
+		      FILEIO_URING_COMPLETE_FUNC complete_func, void *arg, bool * is_ring_failed)
+{
+  struct io_uring_sqe *sqe;
+  struct io_uring_cqe *cqe;
+  unsigned int sq_tail, sq_index, cq_head;
+  unsigned int queued = 0;	/* in submission queue, not consumed by kernel yet */
+  unsigned int in_flight = 0;	/* consumed by kernel, not completed yet */
+  int next_op = 0;
+  int op_index, op_result;
+  int ret;
+  int error_code = NO_ERROR, complete_error;
+
+  assert (ring != NULL && ring->is_initialized);
+
+  *is_ring_failed = false;
+
+  while ((error_code == NO_ERROR && next_op < num_ops) || queued + in_flight > 0)
+    {
+      /* never have more operations in flight than the completion queue can hold */
+      sq_tail = *ring->sq_tail;
+      while (error_code == NO_ERROR && next_op < num_ops && queued + in_flight < ring->sq_entries)
+	{
+	  sq_index = sq_tail & *ring->sq_ring_mask;
+	  sqe = &ring->sqes[sq_index];
+	  memset (sqe, 0, sizeof (*sqe));
+	  prep_func (sqe, next_op, arg);
+	  sqe->user_data = (UINT64) next_op;
+	  ring->sq_array[sq_index] = sq_index;
+
+	  sq_tail++;
+	  next_op++;
+	  queued++;
+	}
+      /* entries must be visible before kernel sees the new tail */
+      __atomic_store_n (ring->sq_tail, sq_tail, __ATOMIC_RELEASE);
+
+      ret = (int) syscall (__NR_io_uring_enter, ring->ring_fd, queued, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+      if (ret < 0 && (errno == EAGAIN || errno == EBUSY) && in_flight > 0)
+	{
+	  /* kernel is out of resources. just wait for completions. */
+	  ret = (int) syscall (__NR_io_uring_enter, ring->ring_fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+	}
+      if (ret < 0)
+	{
+	  if (errno == EINTR)
+	    {
+	      continue;
+	    }
+
+	  fileio_uring_disable (ring, errno);
+	  *is_ring_failed = true;
+	  return error_code;
+	}
+      assert ((unsigned int) ret <= queued);
+      queued -= (unsigned int) ret;
+      in_flight += (unsigned int) ret;
+
+      /* reap completions */
+      cq_head = *ring->cq_head;
+      while (cq_head != __atomic_load_n (ring->cq_tail, __ATOMIC_ACQUIRE))
+	{
+	  cqe = &ring->cqes[cq_head & *ring->cq_ring_mask];
+	  op_index = (int) cqe->user_data;
+	  op_result = cqe->res;
+
+	  /* give the entry back to kernel */
+	  cq_head++;
+	  __atomic_store_n (ring->cq_head, cq_head, __ATOMIC_RELEASE);
+
+	  assert (in_flight > 0);
+	  in_flight--;
+
+	  complete_error = complete_func (thread_p, op_index, op_result, arg);
+	  if (complete_error != NO_ERROR && error_code == NO_ERROR)
+	    {
+	      /* stop submitting. operations in flight are still reaped. */
+	      error_code = complete_error;
+	    }
+	}
+    }
+
+  return error_code;
+}
+
+/*
+ * fileio_uring_prep_write () - Prepare the submission entry of a page write
+ *   return: void
+ *   sqe(out): Submission entry
+ *   index(in): Index of page write in batch
+ *   arg(in): FILEIO_URING_WRITE_ARG
+ */
+static void
+fileio_uring_prep_write (struct io_uring_sqe *sqe, int index, void *arg)
+{
+  FILEIO_URING_WRITE_ARG *write_arg = (FILEIO_URING_WRITE_ARG *) arg;
+  FILEIO_WRITE_REQUEST *request = &write_arg->requests[index];
+
+  sqe->opcode = IORING_OP_WRITE;
+  sqe->fd = request->vol_fd;
+  sqe->off = (UINT64) FILEIO_GET_FILE_SIZE (write_arg->page_size, request->page_id);
+  sqe->addr = (UINT64) (UINTPTR) request->io_page_p;
+  sqe->len = (unsigned int) write_arg->page_size;
+}
+
+/*
+ * fileio_uring_complete_write () - Handle the completion of a page write
+ *   return: error code
+ *   index(in): Index of page write in batch
+ *   result(in): Bytes written or negated errno
+ *   arg(in): FILEIO_URING_WRITE_ARG
+ */
+static int
+fileio_uring_complete_write (THREAD_ENTRY * thread_p, int index, int result, void *arg)
+{
+  FILEIO_URING_WRITE_ARG *write_arg = (FILEIO_URING_WRITE_ARG *) arg;
+  FILEIO_WRITE_REQUEST *request = &write_arg->requests[index];
+  int error_code = NO_ERROR;
+
+  if (result != (int) write_arg->page_size)
+    {
+      if (result == -EINVAL)
+	{
+	  /* kernel does not know IORING_OP_WRITE */
+	  fileio_Uring_disabled = true;
+	}
+
+      /* short write or error. fileio_write retries the page and reports the error. */
+      if (fileio_write (thread_p, request->vol_fd, request->io_page_p, request->page_id, write_arg->page_size,
+			write_arg->write_mode) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      return NO_ERROR;
+    }
+
+  if (write_arg->write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+    {
+      fileio_compensate_flush (thread_p, request->vol_fd, 1);
+    }
+  write_arg->num_written++;
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_uring_prep_fsync () - Prepare the submission entry of a volume synchronization
+ *   return: void
+ *   sqe(out): Submission entry
+ *   index(in): Index of volume
+ *   arg(in): Volume descriptors
+ */
+static void
+fileio_uring_prep_fsync (struct io_uring_sqe *sqe, int index, void *arg)
+{
+  const int *vol_fds = (const int *) arg;
+
+  sqe->opcode = IORING_OP_FSYNC;
+  sqe->fd = vol_fds[index];
+}
+
+/*
+ * fileio_uring_complete_fsync () - Handle the completion of a volume synchronization
+ *   return: error code
+ *   index(in): Index of volume
+ *   result(in): Zero or negated errno
+ *   arg(in): Volume descriptors
+ */
+static int
+fileio_uring_complete_fsync (THREAD_ENTRY * thread_p, int index, int result, void *arg)
+{
+  const int *vol_fds = (const int *) arg;
+  int error_code = NO_ERROR;
+
+  if (result < 0)
+    {
+      /* fileio_synchronize retries and raises the error */
+      if (fileio_synchronize (thread_p, vol_fds[index], fileio_get_volume_label_by_fd (vol_fds[index], PEEK),
+			      FILEIO_SYNC_ONLY) != vol_fds[index])
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      return NO_ERROR;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOSYNCHES);
+
+  return NO_ERROR;
+}
+#endif /* FILEIO_HAVE_IO_URING */
+#endif /* !CS_MODE */
+
 /*
  * fileio_synchronize_bg_archive_volume () -
  *   return:
@@ -5846,6 +6769,22 @@ fileio_make_keys_name (char *keys_name_p, const char *db_full_name_p)
   sprintf (keys_name_p, "%s%s", db_full_name_p, FILEIO_SUFFIX_KEYS);
 }
 
+/*
+ * fileio_make_pb_warmup_name () - Build the name of page buffer warm-up file
+ *   return: void
+ *   warmup_name_p(out): the name of page buffer warm-up file
+ *   db_full_name_p(in): database full path
+ *
+ * Note: The caller must have enough space to store the name of the file
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_pb_warmup_name (char *warmup_name_p, const char *db_full_name_p)
+{
+  sprintf (warmup_name_p, "%s%s", db_full_name_p, FILEIO_SUFFIX_PB_WARMUP);
+}
+
 /*
  * fileio_make_keys_name_given_path () - Build the name of KEYS file (for TDE Master Key)
  *   return: void
@@ -44,6 +44,9 @@
 
 #define NULL_VOLDES   (-1)	/* Value of a null (invalid) vol descriptor */
 
+/* Alignment of buffers, file offsets and sizes required by direct I/O (O_DIRECT) on data volumes */
+#define FILEIO_DIRECT_IO_ALIGNMENT    4096
+
 #define FILEIO_INITIAL_BACKUP_UNITS    0
 #define FILEIO_NO_BACKUP_UNITS         -1
 
@@ -92,6 +95,7 @@
 #define FILEIO_VOLLOCK_SUFFIX        "__lock"
 #define FILEIO_SUFFIX_DWB            "_dwb"
 #define FILEIO_SUFFIX_KEYS           "_keys"
+#define FILEIO_SUFFIX_PB_WARMUP      "_pbwarm"
 #define FILEIO_MAX_SUFFIX_LENGTH     7
 
 typedef enum
@@ -168,6 +172,15 @@ typedef enum
   FILEIO_WRITE_NO_COMPENSATE_WRITE	/* skips */
 } FILEIO_WRITE_MODE;
 
+/* One page write of a fileio_write_batch () request. Pages of a batch may reach the disk in any order. */
+typedef struct fileio_write_request FILEIO_WRITE_REQUEST;
+struct fileio_write_request
+{
+  int vol_fd;			/* volume descriptor */
+  PAGEID page_id;		/* page identifier */
+  void *io_page_p;		/* page content, must stay unchanged until the batch is done */
+};
+
 /* Reserved area of FILEIO_PAGE */
 typedef struct fileio_page_reserved FILEIO_PAGE_RESERVED;
 struct fileio_page_reserved
@@ -498,6 +511,15 @@ extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel,
 			       FILEIO_SYNC_OPTION check_sync_dwb);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
+extern void *fileio_alloc_aligned (size_t size);
+extern void fileio_free_aligned (void *ptr);
+#if !defined (CS_MODE)
+extern int fileio_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests,
+			       size_t page_size, FILEIO_WRITE_MODE write_mode);
+extern int fileio_synchronize_batch (THREAD_ENTRY * thread_p, const int *vol_fds, int num_vols);
+extern bool fileio_is_batch_io_enabled (void);
+extern void fileio_finalize_io_backend (void);
+#endif /* not CS_MODE */
 #if defined (ENABLE_UNUSED_FUNCTION)
 extern void *fileio_read_user_area (THREAD_ENTRY * thread_p, int vdes, PAGEID pageid, off_t start_offset, size_t nbytes,
 				    void *area);
@@ -547,6 +569,7 @@ extern void fileio_make_backup_name (char *backup_name, const char *nopath_volna
 				     FILEIO_BACKUP_LEVEL level, int unit_num);
 extern void fileio_make_dwb_name (char *dwb_name_p, const char *dwb_path_p, const char *db_name_p);
 extern void fileio_make_keys_name (char *keys_name_p, const char *db_name_p);
+extern void fileio_make_pb_warmup_name (char *warmup_name_p, const char *db_full_name_p);
 extern void fileio_make_keys_name_given_path (char *keys_name_p, const char *keys_path_p, const char *db_name_p);
 #ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
 extern void fileio_make_ha_sock_name (char *sock_path_p, const char *base_path_p, const char *sock_name_p);
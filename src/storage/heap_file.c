@@ -69,11 +69,14 @@
 #endif /* ENABLE_SYSTEMTAP */
 #include "dbtype.h"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
+#include "thread_worker_pool.hpp"
 #include "db_value_printer.hpp"
 #include "log_append.hpp"
 #include "string_buffer.hpp"
 #include "tde.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <set>
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
@@ -89,11 +92,6 @@ static int rv;
 
 #define HEAP_BESTSPACE_SYNC_THRESHOLD (0.1f)
 
-/* ATTRIBUTE LOCATION */
-
-#define OR_FIXED_ATTRIBUTES_OFFSET_BY_OBJ(obj, nvars) \
-  (OR_HEADER_SIZE(obj) + OR_VAR_TABLE_SIZE_INTERNAL(nvars, OR_GET_OFFSET_SIZE(obj)))
-
 #define HEAP_GUESS_NUM_ATTRS_REFOIDS 100
 #define HEAP_GUESS_NUM_INDEXED_ATTRS 100
 
@@ -301,6 +299,20 @@ struct heap_chkall_relocoids
   OID *unfound_reloc_oids;	/* The relocation OIDs that have not been found in hash table */
 };
 
+#define HEAP_PARALLEL_SCAN_RANGE_NPAGES 64	/* pages handed out at once to a parallel scan worker */
+
+// *INDENT-OFF*
+typedef struct heap_page_range_dispenser HEAP_PAGE_RANGE_DISPENSER;
+struct heap_page_range_dispenser
+{				/* Hands out consecutive runs of heap pages to the workers of a parallel heap scan */
+  std::mutex mutex;
+  const HFID *hfid;
+  VPID next_vpid;		/* next page of the chain to hand out; NULL when the heap is exhausted */
+  PGBUF_READ_AHEAD read_ahead;	/* read-ahead of the page chain walk */
+  bool stop;			/* a worker failed, no more ranges are handed out */
+};
+// *INDENT-ON*
+
 #define DEFAULT_REPR_INCREMENT 16
 
 enum
@@ -815,6 +827,7 @@ static int heap_insert_adjust_recdes_header (THREAD_ENTRY * thread_p, HEAP_OPERA
 static int heap_update_adjust_recdes_header (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * update_context,
 					     bool is_mvcc_class);
 static int heap_insert_handle_multipage_record (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
+static bool heap_insert_can_elide_lock (const HEAP_OPERATION_CONTEXT * context);
 static int heap_get_insert_location_with_lock (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context,
 					       PGBUF_WATCHER * home_hint_p);
 static int heap_find_location_and_insert_rec_newhome (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
@@ -900,6 +913,21 @@ static int heap_update_and_log_header (THREAD_ENTRY * thread_p, const HFID * hfi
 				       const PGBUF_WATCHER heap_header_watcher, HEAP_HDR_STATS * heap_hdr,
 				       const VPID new_next_vpid, const VPID new_last_vpid, const int new_num_pages);
 
+static int heap_page_range_dispense (THREAD_ENTRY * thread_p, HEAP_PAGE_RANGE_DISPENSER * dispenser, VPID * vpids,
+				     int *npages);
+static int heap_fix_dispensed_page (THREAD_ENTRY * thread_p, const VPID * vpid, const OID * class_oid,
+				    HEAP_SCANCACHE * scan_cache);
+static int heap_count_objects_in_ranges (THREAD_ENTRY * thread_p, HEAP_PAGE_RANGE_DISPENSER * dispenser,
+					 const OID * class_oid, MVCC_SNAPSHOT * mvcc_snapshot, INT64 * count);
+
+#if defined (SERVER_MODE)
+// *INDENT-OFF*
+static std::mutex heap_Parallel_scan_mutex;
+static cubthread::entry_workpool *heap_Parallel_scan_workers = NULL;
+static cubthread::system_worker_entry_manager *heap_Parallel_scan_context_manager = NULL;
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
 /*
  * heap_hash_vpid () - Hash a page identifier
  *   return: hash value
@@ -5230,6 +5258,15 @@ heap_manager_finalize (void)
 
   heap_finalize_hfid_table ();
 
+#if defined (SERVER_MODE)
+  if (heap_Parallel_scan_workers != NULL)
+    {
+      cubthread::get_manager ()->destroy_worker_pool (heap_Parallel_scan_workers);
+      delete heap_Parallel_scan_context_manager;
+      heap_Parallel_scan_context_manager = NULL;
+    }
+#endif /* SERVER_MODE */
+
   return ret;
 }
 
@@ -6884,6 +6921,8 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->node.classname = NULL;
   scan_cache->cache_last_fix_page = cache_last_fix_page;
   PGBUF_INIT_WATCHER (&(scan_cache->page_watcher), PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
+  scan_cache->range_npages = -1;
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
@@ -7182,6 +7221,8 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->node.classname = NULL;
   scan_cache->page_latch = S_LOCK;
   scan_cache->cache_last_fix_page = true;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
+  scan_cache->range_npages = -1;
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
@@ -7882,6 +7923,7 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
   SCAN_CODE scan = S_ERROR;
   int get_rec_info = cache_recordinfo != NULL;
   bool is_null_recdata;
+  bool is_bulk_read;
   PGBUF_WATCHER old_page_watcher;
   PGBUF_WATCHER rec_info_page_watcher;
 
@@ -7966,9 +8008,25 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 	    }
 	  if (scan_cache->page_watcher.pgptr == NULL)
 	    {
+	      is_bulk_read = false;
+	      if (!reversed_direction && sampling == NULL)
+		{
+		  pgbuf_read_ahead_notify (thread_p, &scan_cache->read_ahead, &vpid);
+		  /* pages of a large scan are admitted through a small buffer ring, so the scan does not evict the
+		   * working set of other transactions */
+		  is_bulk_read = pgbuf_is_bulk_read_scan (&scan_cache->read_ahead);
+		}
+	      if (is_bulk_read)
+		{
+		  pgbuf_bulk_read_begin (thread_p);
+		}
 	      scan_cache->page_watcher.pgptr =
 		heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, scan_cache,
 					     &scan_cache->page_watcher);
+	      if (is_bulk_read)
+		{
+		  pgbuf_bulk_read_end (thread_p);
+		}
 	      if (old_page_watcher.pgptr != NULL)
 		{
 		  pgbuf_ordered_unfix (thread_p, &old_page_watcher);
@@ -8083,6 +8141,11 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 		      else
 			{
 			  (void) heap_vpid_next (thread_p, hfid, scan_cache->page_watcher.pgptr, &vpid);
+			  if (scan_cache->range_npages > 0 && --scan_cache->range_npages == 0)
+			    {
+			      /* end of the pages given to this scan */
+			      VPID_SET_NULL (&vpid);
+			    }
 			}
 		    }
 		  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &old_page_watcher);
@@ -9105,6 +9168,341 @@ heap_get_num_objects (THREAD_ENTRY * thread_p, const HFID * hfid, int *npages, i
   return *nobjs;
 }
 
+/*
+ * heap_page_range_dispense () - Hand out the next range of pages of a parallel heap scan
+ *   return: NO_ERROR or error code
+ *   dispenser(in/out): page range dispenser of the scan
+ *   vpids(out): pages of the range, at most HEAP_PARALLEL_SCAN_RANGE_NPAGES
+ *   npages(out): number of pages of the range; 0 when there are no more pages
+ *
+ * Note: The page chain is walked under the dispenser mutex; the pages of the range are only latched long enough to
+ *       read their next link, the records are read by the worker afterwards. The worker gets the exact list of
+ *       pages, so it never follows the chain out of its range when pages are deallocated meanwhile.
+ */
+static int
+heap_page_range_dispense (THREAD_ENTRY * thread_p, HEAP_PAGE_RANGE_DISPENSER * dispenser, VPID * vpids,
+			  int *npages)
+{
+  PAGE_PTR pgptr;
+  int error_code = NO_ERROR;
+
+  // *INDENT-OFF*
+  std::lock_guard<std::mutex> dispenser_lock (dispenser->mutex);
+  // *INDENT-ON*
+
+  *npages = 0;
+
+  if (dispenser->stop)
+    {
+      return NO_ERROR;
+    }
+
+  while (*npages < HEAP_PARALLEL_SCAN_RANGE_NPAGES && !VPID_ISNULL (&dispenser->next_vpid))
+    {
+      pgbuf_read_ahead_notify (thread_p, &dispenser->read_ahead, &dispenser->next_vpid);
+      pgptr = pgbuf_fix (thread_p, &dispenser->next_vpid, OLD_PAGE_PREVENT_DEALLOC, PGBUF_LATCH_READ,
+			 PGBUF_UNCONDITIONAL_LATCH);
+      if (pgptr == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  dispenser->stop = true;
+	  return error_code;
+	}
+
+      vpids[(*npages)++] = dispenser->next_vpid;
+      error_code = heap_vpid_next (thread_p, dispenser->hfid, pgptr, &dispenser->next_vpid);
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      if (error_code != NO_ERROR)
+	{
+	  dispenser->stop = true;
+	  *npages = 0;
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_fix_dispensed_page () - Fix a page handed out by a page range dispenser for the scan of a worker
+ *   return: NO_ERROR or error code
+ *   vpid(in): page handed out
+ *   class_oid(in): class of the heap
+ *   scan_cache(in/out): scan cache of the worker; the page is fixed in its page watcher, which is left empty if the
+ *                       page no longer belongs to the heap
+ *
+ * Note: Vacuum may deallocate a page after it was handed out. It only deallocates empty pages, so such a page holds
+ *       no object visible to the scan and is skipped.
+ */
+static int
+heap_fix_dispensed_page (THREAD_ENTRY * thread_p, const VPID * vpid, const OID * class_oid,
+			 HEAP_SCANCACHE * scan_cache)
+{
+  PAGE_PTR pgptr;
+  OID page_class_oid;
+  int error_code;
+
+  assert (scan_cache->page_watcher.pgptr == NULL);
+
+  /* the latch keeps the page from being deallocated until the scan fixed it too */
+  pgptr = pgbuf_fix (thread_p, vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (pgptr == NULL)
+    {
+      if (er_errid () == ER_PB_BAD_PAGEID)
+	{
+	  /* deallocated */
+	  er_clear ();
+	  return NO_ERROR;
+	}
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP
+      || heap_get_class_oid_from_page (thread_p, pgptr, &page_class_oid) != NO_ERROR
+      || !OID_EQ (&page_class_oid, class_oid))
+    {
+      /* deallocated and allocated again to another file */
+      er_clear ();
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      return NO_ERROR;
+    }
+
+  error_code = pgbuf_ordered_fix (thread_p, vpid, OLD_PAGE, PGBUF_LATCH_READ, &scan_cache->page_watcher);
+  pgbuf_unfix_and_init (thread_p, pgptr);
+
+  return error_code;
+}
+
+/*
+ * heap_count_objects_in_ranges () - Count the visible objects of the page ranges taken from a dispenser
+ *   return: NO_ERROR or error code
+ *   dispenser(in/out): page range dispenser of the scan
+ *   class_oid(in): class of the heap
+ *   mvcc_snapshot(in): snapshot of the scanning transaction
+ *   count(out): number of visible objects found
+ */
+static int
+heap_count_objects_in_ranges (THREAD_ENTRY * thread_p, HEAP_PAGE_RANGE_DISPENSER * dispenser, const OID * class_oid,
+			      MVCC_SNAPSHOT * mvcc_snapshot, INT64 * count)
+{
+  HEAP_SCANCACHE scan_cache;
+  RECDES recdes = RECDES_INITIALIZER;
+  VPID vpids[HEAP_PARALLEL_SCAN_RANGE_NPAGES];
+  int npages;
+  int i;
+  OID oid;
+  OID scan_class_oid;
+  SCAN_CODE scan = S_END;
+  int error_code;
+
+  *count = 0;
+
+  /* the coordinator holds the class lock for the whole scan */
+  error_code = heap_scancache_start_internal (thread_p, &scan_cache, dispenser->hfid, class_oid, true, false,
+					      mvcc_snapshot);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  while (true)
+    {
+      error_code = heap_page_range_dispense (thread_p, dispenser, vpids, &npages);
+      if (error_code != NO_ERROR || npages == 0)
+	{
+	  break;
+	}
+
+      /* each page is scanned on its own; the scan does not follow the page chain */
+      for (i = 0; i < npages; i++)
+	{
+	  error_code = heap_fix_dispensed_page (thread_p, &vpids[i], class_oid, &scan_cache);
+	  if (error_code != NO_ERROR)
+	    {
+	      break;
+	    }
+	  if (scan_cache.page_watcher.pgptr == NULL)
+	    {
+	      /* no longer a page of the heap */
+	      continue;
+	    }
+
+	  oid.volid = vpids[i].volid;
+	  oid.pageid = vpids[i].pageid;
+	  oid.slotid = NULL_SLOTID;
+	  COPY_OID (&scan_class_oid, class_oid);
+	  scan_cache.range_npages = 1;
+
+	  while ((scan = heap_next (thread_p, dispenser->hfid, &scan_class_oid, &oid, &recdes, &scan_cache, PEEK))
+		 == S_SUCCESS)
+	    {
+	      (*count)++;
+	    }
+
+	  if (scan != S_END)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      break;
+	    }
+	}
+
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+  if (error_code != NO_ERROR)
+    {
+      // *INDENT-OFF*
+      std::lock_guard<std::mutex> dispenser_lock (dispenser->mutex);
+      // *INDENT-ON*
+      dispenser->stop = true;
+    }
+
+  heap_scancache_end (thread_p, &scan_cache);
+
+  return error_code;
+}
+
+/*
+ * heap_parallel_scan_default_degree () - Degree of a parallel heap scan that the configuration does not set
+ *   return: one thread per core, as many as the shared scan worker pool has; 1 outside of the server
+ */
+int
+heap_parallel_scan_default_degree (void)
+{
+#if defined (SERVER_MODE)
+  return (int) cubthread::system_core_count ();
+#else /* !SERVER_MODE */
+  return 1;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * heap_parallel_count_objects () - Count the objects of a heap visible to a snapshot using several threads
+ *   return: NO_ERROR or error code
+ *   hfid(in): heap file identifier
+ *   class_oid(in): class of the heap; the caller must hold a lock on it
+ *   mvcc_snapshot(in): snapshot of the current transaction
+ *   degree(in): number of threads scanning the heap, including the caller
+ *   count(out): number of visible objects
+ *
+ * Note: The pages of the heap are handed out in ranges of HEAP_PARALLEL_SCAN_RANGE_NPAGES on demand, so a worker
+ *       slowed down by I/O does not hold back the others. Workers read on behalf of the caller's transaction, which
+ *       waits for all of them and scans its share of ranges meanwhile. Outside of the server the scan is sequential.
+ */
+int
+heap_parallel_count_objects (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid,
+			     MVCC_SNAPSHOT * mvcc_snapshot, int degree, INT64 * count)
+{
+  HEAP_PAGE_RANGE_DISPENSER dispenser;
+  INT64 own_count = 0;
+  int error_code = NO_ERROR;
+
+  assert (mvcc_snapshot != NULL && class_oid != NULL);
+
+  dispenser.hfid = hfid;
+  dispenser.next_vpid.volid = hfid->vfid.volid;
+  dispenser.next_vpid.pageid = hfid->hpgid;
+  pgbuf_read_ahead_init (&dispenser.read_ahead);
+  dispenser.stop = false;
+
+  *count = 0;
+
+#if defined (SERVER_MODE)
+  // *INDENT-OFF*
+  std::mutex workers_mutex;
+  std::condition_variable workers_cv;
+  // *INDENT-ON*
+  const int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  int workers_remaining = 0;
+  int workers_error = NO_ERROR;
+  OR_ALIGNED_BUF (1024) workers_error_area;
+  int i;
+
+  if (degree > 1)
+    {
+      heap_Parallel_scan_mutex.lock ();
+      if (heap_Parallel_scan_workers == NULL)
+	{
+	  const std::size_t pool_size = cubthread::system_core_count ();
+
+	  heap_Parallel_scan_context_manager = new cubthread::system_worker_entry_manager (TT_WORKER);
+	  heap_Parallel_scan_workers =
+	    cubthread::get_manager ()->create_worker_pool (pool_size, 4 * pool_size, "heap_parallel_scan_workers",
+							   heap_Parallel_scan_context_manager, 1, false);
+	  if (heap_Parallel_scan_workers == NULL)
+	    {
+	      /* scan sequentially */
+	      delete heap_Parallel_scan_context_manager;
+	      heap_Parallel_scan_context_manager = NULL;
+	    }
+	}
+      heap_Parallel_scan_mutex.unlock ();
+    }
+
+  if (degree > 1 && heap_Parallel_scan_workers != NULL)
+    {
+      workers_remaining = degree - 1;
+      for (i = 1; i < degree; i++)
+	{
+	  // *INDENT-OFF*
+	  auto count_func = [&] (cubthread::entry & context)
+	    {
+	      INT64 worker_count = 0;
+	      int worker_error;
+
+	      /* visibility of the records inserted by the scanning transaction depends on the transaction index */
+	      context.tran_index = tran_index;
+	      worker_error = heap_count_objects_in_ranges (&context, &dispenser, class_oid, mvcc_snapshot,
+							   &worker_count);
+	      context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+
+	      std::unique_lock<std::mutex> ulock (workers_mutex);
+	      *count += worker_count;
+	      if (worker_error != NO_ERROR && workers_error == NO_ERROR)
+		{
+		  int area_length = sizeof (workers_error_area);
+
+		  /* keep the error of the worker thread to be set again on the caller thread */
+		  workers_error = worker_error;
+		  (void) er_get_area_error (OR_ALIGNED_BUF_START (workers_error_area), &area_length);
+		}
+	      if (--workers_remaining == 0)
+		{
+		  workers_cv.notify_one ();
+		}
+	    };
+	  cubthread::get_manager ()->push_task (heap_Parallel_scan_workers,
+						new cubthread::entry_callable_task (count_func));
+	  // *INDENT-ON*
+	}
+    }
+#endif /* SERVER_MODE */
+
+  error_code = heap_count_objects_in_ranges (thread_p, &dispenser, class_oid, mvcc_snapshot, &own_count);
+
+#if defined (SERVER_MODE)
+  {
+    // *INDENT-OFF*
+    std::unique_lock<std::mutex> ulock (workers_mutex);
+    workers_cv.wait (ulock, [&workers_remaining] { return workers_remaining == 0; });
+    // *INDENT-ON*
+    if (error_code == NO_ERROR && workers_error != NO_ERROR)
+      {
+	/* the error was set on the worker thread; set it again with its id and message on this thread */
+	error_code = er_set_area_error (OR_ALIGNED_BUF_START (workers_error_area));
+      }
+  }
+#endif /* SERVER_MODE */
+
+  *count += own_count;
+
+  return error_code;
+}
+
 /*
  * heap_estimate () - Estimate the number of pages, objects, average length
  *   return: number of pages estimated or -1 in case of an error
@@ -20436,6 +20834,26 @@ heap_insert_handle_multipage_record (THREAD_ENTRY * thread_p, HEAP_OPERATION_CON
   return NO_ERROR;
 }
 
+/*
+ * heap_insert_can_elide_lock () - can the instance lock of an insert be left to its MVCC header?
+ *   context(in): operation context
+ *   returns: true if the lock may be elided
+ *
+ * NOTE: Only plain inserts into MVCC classes qualify: the record header then carries the insert MVCCID of the
+ *       current transaction, which is what lock_inflate_elided_object_lock () looks for.
+ */
+static bool
+heap_insert_can_elide_lock (const HEAP_OPERATION_CONTEXT * context)
+{
+  if (!prm_get_bool_value (PRM_ID_LK_ELIDE_INSERT_LOCKS))
+    {
+      return false;
+    }
+
+  return (context->update_in_place == UPDATE_INPLACE_NONE && !context->is_bulk_op
+	  && context->recdes_p->type != REC_ASSIGN_ADDRESS && !mvcc_is_mvcc_disabled_class (&context->class_oid));
+}
+
 /*
  * heap_get_insert_location_with_lock () - get a page (and possibly and slot)
  *				    for insert and lock the OID
@@ -20536,6 +20954,14 @@ heap_get_insert_location_with_lock (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONT
 	  return NO_ERROR;
 	}
 
+      if (lock == X_LOCK && slot_id == slot_count && heap_insert_can_elide_lock (context))
+	{
+	  /* a new slot was never locked by anyone; the insert MVCCID in the record header stands for the lock. it is
+	   * materialized by lock_inflate_elided_object_lock () if another transaction conflicts with us. */
+	  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_ELIDED_ON_OBJECTS);
+	  return NO_ERROR;
+	}
+
       /* lock the object to be inserted conditionally */
       lk_result = lock_object (thread_p, &context->res_oid, &context->class_oid, lock, LK_COND_LOCK);
       if (lk_result == LK_GRANTED)
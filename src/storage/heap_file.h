@@ -150,6 +150,8 @@ struct heap_scancache
 				 * been locked with either S_LOCK, SIX_LOCK, or X_LOCK */
     bool cache_last_fix_page;	/* Indicates if page buffers and memory are cached (left fixed) */
     PGBUF_WATCHER page_watcher;
+    PGBUF_READ_AHEAD read_ahead;	/* sequential read-ahead state of heap scan */
+    int range_npages;		/* pages a forward scan reads before it ends; -1 to scan up to the last page */
     int num_btids;		/* Total number of indexes defined on the scanning class */
     multi_index_unique_stats *m_index_stats;	// does this really belong to scan cache??
     FILE_TYPE file_type;		/* The file type of the heap file being scanned. Can be FILE_HEAP or
@@ -455,6 +457,9 @@ extern SCAN_CODE heap_scanrange_last (THREAD_ENTRY * thread_p, OID * last_oid, R
 extern bool heap_does_exist (THREAD_ENTRY * thread_p, OID * class_oid, const OID * oid);
 extern bool heap_is_object_not_null (THREAD_ENTRY * thread_p, OID * class_oid, const OID * oid);
 extern int heap_get_num_objects (THREAD_ENTRY * thread_p, const HFID * hfid, int *npages, int *nobjs, int *avg_length);
+extern int heap_parallel_count_objects (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid,
+					MVCC_SNAPSHOT * mvcc_snapshot, int degree, INT64 * count);
+extern int heap_parallel_scan_default_degree (void);
 
 extern int heap_estimate (THREAD_ENTRY * thread_p, const HFID * hfid, int *npages, int *nobjs, int *avg_length);
 extern int heap_estimate_num_objects (THREAD_ENTRY * thread_p, const HFID * hfid);
@@ -62,6 +62,7 @@
 #include "show_scan.h"
 #include "numeric_opfunc.h"
 #include "dbtype.h"
+#include "lz4.h"
 
 #if defined(SERVER_MODE)
 #include "connection_error.h"
@@ -133,15 +134,27 @@ static int rv;
 #define PGBUF_FIND_IOPAGE_PTR(i) \
   ((PGBUF_IOPAGE_BUFFER *) ((char *) &(pgbuf_Pool.iopage_table[0]) + (PGBUF_IOPAGE_BUFFER_SIZE * (i))))
 
+/* BCB of an iopage buffer; both tables have the same order. */
+#define PGBUF_FIND_BCB_OF_IOPAGE(ioptr) \
+  PGBUF_FIND_BCB_PTR (((char *) (ioptr) - (char *) &(pgbuf_Pool.iopage_table[0])) / PGBUF_IOPAGE_BUFFER_SIZE)
+
+/* NUMA node of a buffer. with NUMA-aware buffer, the pool is split in one contiguous partition per node. */
+#define PGBUF_NUMA_NODE_OF_BUFFER(bufid) \
+  ((int) ((INT64) (bufid) * pgbuf_Pool.numa_nodes / pgbuf_Pool.num_buffers))
+
+/* check whether the page pointer is in buffer pool or it is a copy made by pgbuf_read_optimistic () */
+#define PGBUF_IS_PAGE_IN_POOL(pgptr) \
+  ((char *) (pgptr) >= (char *) PGBUF_FIND_IOPAGE_PTR (0) \
+   && (char *) (pgptr) < (char *) PGBUF_FIND_IOPAGE_PTR (pgbuf_Pool.num_buffers))
+
 #define PGBUF_FIND_BUFFER_GUARD(bufptr) \
   (&bufptr->iopage_buffer->iopage.page[DB_PAGESIZE])
 
 /* macros for casting pointers */
 #define CAST_PGPTR_TO_BFPTR(bufptr, pgptr) \
   do { \
-    (bufptr) = ((PGBUF_BCB *) ((PGBUF_IOPAGE_BUFFER *) \
-      ((char *) pgptr - offsetof (PGBUF_IOPAGE_BUFFER, iopage.page)))->bcb); \
-    assert ((bufptr) == (bufptr)->iopage_buffer->bcb); \
+    (bufptr) = PGBUF_FIND_BCB_OF_IOPAGE ((char *) pgptr - offsetof (PGBUF_IOPAGE_BUFFER, iopage.page)); \
+    assert ((char *) (bufptr)->iopage_buffer + offsetof (PGBUF_IOPAGE_BUFFER, iopage.page) == (char *) (pgptr)); \
   } while (0)
 
 #define CAST_PGPTR_TO_IOPGPTR(io_pgptr, pgptr) \
@@ -156,7 +169,7 @@ static int rv;
 
 #define CAST_BFPTR_TO_PGPTR(pgptr, bufptr) \
   do { \
-    assert ((bufptr) == (bufptr)->iopage_buffer->bcb); \
+    assert ((bufptr) == PGBUF_FIND_BCB_OF_IOPAGE ((bufptr)->iopage_buffer)); \
     (pgptr) = ((PAGE_PTR) ((char *) (bufptr->iopage_buffer) + offsetof (PGBUF_IOPAGE_BUFFER, iopage.page))); \
   } while (0)
 
@@ -282,6 +295,9 @@ typedef enum
 
 #define PGBUF_HASH_VALUE(vpid) pgbuf_hash_func_mirror(vpid)
 
+/* how many times a lookup walks again the hash chain without hash mutex when the chain is changed during the walk */
+#define PGBUF_HASH_OPTIMISTIC_MAX_RETRIES 8
+
 /* Maximum overboost flush multiplier: controls the maximum factor to apply to configured flush ratio,
  * when the miss rate (victim_request/fix_request) increases.
  */
@@ -308,6 +324,31 @@ typedef enum
 /* default pages to flush in each interval during log checkpoint */
 #define PGBUF_CHKPT_BURST_PAGES 16
 
+/* maximum number of pages in a read-ahead window (upper limit of data_buffer_read_ahead_pages) */
+#define PGBUF_READ_AHEAD_MAX_PAGES 128
+/* number of consecutive forward page accesses before a scan is considered sequential */
+#define PGBUF_READ_AHEAD_MIN_SEQUENTIAL 2
+/* maximum distance between consecutive pages of a sequential scan. heap and list file pages follow allocation order,
+ * which is not always contiguous (e.g. file table or overflow pages are interleaved). */
+#define PGBUF_READ_AHEAD_MAX_GAP 4
+/* a scan is admitted through a bulk read ring once it fixed this many sequential pages. it must also cover a sixteenth
+ * of the buffer, so small scans keep using the regular LRU admission. */
+#define PGBUF_BULK_READ_MIN_SEQUENTIAL(ring_npages) (MAX ((ring_npages), pgbuf_Pool.num_buffers / 16))
+
+#if defined (SERVER_MODE)
+/* buffer pool warm-up file */
+#define PGBUF_WARMUP_FILE_MAGIC 0x50425755	/* "PBWU" */
+#define PGBUF_WARMUP_FILE_VERSION 1
+/* pages of lru zone 2 are saved for warm-up only if they were fixed at least this many times */
+#define PGBUF_WARMUP_MIN_FIX_COUNT 2
+/* windows of pages reloaded in one run of read-ahead daemon */
+#define PGBUF_WARMUP_WINDOWS_PER_RUN 1024
+#endif /* SERVER_MODE */
+#if defined (SERVER_MODE)
+/* read-ahead keeps a run of pages buffer-locked; its buffer lock entries follow the entries of threads */
+#define PGBUF_READ_AHEAD_BUFFER_LOCK(i) (&pgbuf_Pool.buf_lock_table[thread_num_total_threads () + (i)])
+#endif /* SERVER_MODE */
+
 #define INIT_HOLDER_STAT(perf_stat) \
   do \
     { \
@@ -497,20 +538,19 @@ struct pgbuf_bcb
 						 * be changed atomically... 2-byte sized atomic operations are not
 						 * common. */
   int hit_age;			/* age of last hit (used to compute activities and quotas) */
+  volatile int version;		/* validates optimistic reads of the page, see pgbuf_read_optimistic (). it is odd
+				 * while the BCB is not in the buffer hash chain and it is changed whenever the page
+				 * is write latched. */
 
   LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
 };
 
 /* iopage buffer structure */
+/* The iopage table is allocated aligned for direct I/O. The BCB of an iopage buffer is found by its index in table,
+ * a back pointer would break the alignment of pages. */
 struct pgbuf_iopage_buffer
 {
-  PGBUF_BCB *bcb;		/* pointer to BCB structure */
-#if (__WORDSIZE == 32)
-  int dummy;			/* for 8byte align of iopage */
-#elif !defined(LINUX) && !defined(WINDOWS) && !defined(AIX)
-#error "you must check that iopage is aligned by 8byte !!"
-#endif
   FILEIO_PAGE iopage;		/* The actual buffered io page */
 };
 
@@ -531,12 +571,16 @@ struct pgbuf_buffer_lock
 /* buffer hash entry structure
  *
  * buffer hash table is the array of buffer hash entries.
+ * hash_mutex serializes the changes of buffer hash chain and buffer lock chain. Lookups of resident pages walk the
+ * hash chain without hash_mutex and use version as a sequence lock: it is odd while the chain is being changed and it
+ * is incremented after each change, so a reader can tell whether its walk may have missed a BCB.
  */
 struct pgbuf_buffer_hash
 {
 #if defined(SERVER_MODE)
   pthread_mutex_t hash_mutex;	/* hash mutex for the integrity of buffer hash chain and buffer lock chain. */
 #endif				/* SERVER_MODE */
+  volatile int version;		/* sequence lock of buffer hash chain */
   PGBUF_BCB *hash_next;		/* the anchor of buffer hash chain */
   PGBUF_BUFFER_LOCK *lock_next;	/* the anchor of buffer lock chain */
 };
@@ -708,8 +752,91 @@ struct pgbuf_direct_victim
   /* *INDENT-ON* */
 };
 #define PGBUF_FLUSHED_BCBS_BUFFER_SIZE (8 * 1024)	/* 8k */
+#define PGBUF_READ_AHEAD_REQUESTS_BUFFER_SIZE 1024
+#endif /* SERVER_MODE */
+
+/* PGBUF_READ_AHEAD_REQUEST - window of contiguous pages to be loaded before a sequential scan fixes them. */
+typedef struct pgbuf_read_ahead_request PGBUF_READ_AHEAD_REQUEST;
+struct pgbuf_read_ahead_request
+{
+  VPID vpid;			/* first page of window */
+  int npages;			/* number of pages in window */
+};
+
+#if defined (SERVER_MODE)
+/* PGBUF_WARMUP_FILE_HEADER - header of buffer pool warm-up file. it is followed by the sorted array of page ids. */
+typedef struct pgbuf_warmup_file_header PGBUF_WARMUP_FILE_HEADER;
+struct pgbuf_warmup_file_header
+{
+  int magic;
+  int version;
+  int page_size;
+  int npages;
+};
+
+/* PGBUF_WARMUP - buffer pool warm-up. the pages of hot buffers are saved periodically and on shutdown, and they are
+ * reloaded by read-ahead daemon on next server start, while the buffer still has free buffers. */
+typedef struct pgbuf_warmup PGBUF_WARMUP;
+struct pgbuf_warmup
+{
+  VPID *vpids;			/* sorted pages to reload; NULL if no reload is in progress */
+  int npages;			/* number of pages to reload */
+  int next;			/* index of next page to reload */
+  int loaded;			/* number of pages reloaded */
+  bool is_started;		/* true once warm-up file was looked for */
+  time_t last_dump_time;	/* time when hot pages were last saved */
+};
 #endif /* SERVER_MODE */
 
+/* PGBUF_BULK_READ_RING - small ring of buffers recycled by a thread doing a large sequential scan. pages of such scans
+ * are admitted at the bottom of LRU and, once the ring is full, the scan reuses its own oldest buffer instead of
+ * victimizing pages of other workloads. */
+typedef struct pgbuf_bulk_read_ring PGBUF_BULK_READ_RING;
+struct pgbuf_bulk_read_ring
+{
+  PGBUF_BCB **bcbs;		/* buffers admitted by the scan */
+  VPID *vpids;			/* pages loaded in buffers when admitted */
+  int cursor;			/* next slot to be reused */
+  int nesting;			/* bulk read scope nesting; ring is used while positive */
+};
+
+/* PGBUF_COMPRESSED_PAGE - LZ4-compressed image of a clean page evicted from buffer. a page is either in buffer or in
+ * compressed cache, never in both: it is stored before its bcb leaves the hash chain and it is removed when the page
+ * is loaded in buffer again. */
+typedef struct pgbuf_compressed_page PGBUF_COMPRESSED_PAGE;
+struct pgbuf_compressed_page
+{
+  VPID vpid;			/* page identifier */
+  int alloc_size;		/* allocated size of this entry */
+  int data_size;		/* size of compressed page */
+  bool in_fifo;			/* true while the page is in eviction list */
+  PGBUF_COMPRESSED_PAGE *hash_next;	/* next page in bucket */
+  PGBUF_COMPRESSED_PAGE *fifo_prev;	/* page stored after this one */
+  PGBUF_COMPRESSED_PAGE *fifo_next;	/* page stored before this one */
+  char data[1];			/* compressed page */
+};
+
+typedef struct pgbuf_compressed_cache_bucket PGBUF_COMPRESSED_CACHE_BUCKET;
+struct pgbuf_compressed_cache_bucket
+{
+  pthread_mutex_t mutex;
+  PGBUF_COMPRESSED_PAGE *head;
+};
+
+/* PGBUF_COMPRESSED_CACHE - second level cache of evicted clean pages, kept compressed in memory. pages are evicted in
+ * the order they were stored; since a page leaves the cache when it is used, this is the order of last use. */
+typedef struct pgbuf_compressed_cache PGBUF_COMPRESSED_CACHE;
+struct pgbuf_compressed_cache
+{
+  PGBUF_COMPRESSED_CACHE_BUCKET *buckets;
+  int num_buckets;		/* 0 if compressed cache is disabled */
+  INT64 max_size;		/* memory limit of cache */
+  volatile INT64 size;		/* memory used by cached pages */
+  pthread_mutex_t fifo_mutex;	/* protects eviction list; acquired after a bucket mutex, never before */
+  PGBUF_COMPRESSED_PAGE *fifo_head;	/* most recently stored page */
+  PGBUF_COMPRESSED_PAGE *fifo_tail;	/* oldest page, evicted first */
+};
+
 /* The buffer Pool */
 struct pgbuf_buffer_pool
 {
@@ -722,6 +849,8 @@ struct pgbuf_buffer_pool
   PGBUF_BUFFER_HASH *buf_hash_table;	/* buffer hash table */
   PGBUF_BUFFER_LOCK *buf_lock_table;	/* buffer lock table */
   PGBUF_IOPAGE_BUFFER *iopage_table;	/* IO page table */
+  OS_LARGE_PAGE_TYPE BCB_table_page_type;	/* pages backing BCB table */
+  OS_LARGE_PAGE_TYPE iopage_table_page_type;	/* pages backing IO page table */
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
   float ratio_lru2;		/* ratio for lru 2 zone */
@@ -780,7 +909,20 @@ struct pgbuf_buffer_pool
   lockfree::circular_queue<int> *private_lrus_with_victims;
   lockfree::circular_queue<int> *big_private_lrus_with_victims;
   lockfree::circular_queue<int> *shared_lrus_with_victims;
+#if defined (SERVER_MODE)
+  lockfree::circular_queue<PGBUF_READ_AHEAD_REQUEST> *read_ahead_requests;	/* consumed by read-ahead daemon */
+#endif				/* SERVER_MODE */
   /* *INDENT-ON* */
+  char *read_ahead_io_area;	/* area for batched read of contiguous read-ahead pages */
+  PGBUF_BULK_READ_RING *bulk_read_rings;	/* per-thread rings of large sequential scans */
+  int bulk_read_ring_npages;	/* size of each ring; 0 if rings are disabled */
+  PGBUF_COMPRESSED_CACHE compressed_cache;	/* compressed cache of evicted clean pages */
+#if defined (SERVER_MODE)
+  PGBUF_WARMUP warmup;		/* buffer pool warm-up */
+#endif /* SERVER_MODE */
+  int numa_nodes;		/* number of NUMA partitions of buffer; 1 if buffer is not NUMA-aware. shared lru list
+				 * i belongs to node i % numa_nodes and it only holds buffers of that node. */
+  unsigned int numa_victim_cursor;	/* round-robin cursor for searching victims in shared lists of a node */
 
   PGBUF_STATUS *show_status;
   PGBUF_STATUS_OLD show_status_old;
@@ -1021,7 +1163,14 @@ static int pgbuf_bcb_safe_flush_force_unlock (THREAD_ENTRY * thread_p, PGBUF_BCB
 static PGBUF_BCB *pgbuf_get_bcb_from_invalid_list (THREAD_ENTRY * thread_p);
 static int pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
 
-STATIC_INLINE int pgbuf_get_shared_lru_index_for_add (void) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int pgbuf_get_shared_lru_index_for_add (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+static void pgbuf_initialize_numa (void);
+static void pgbuf_numa_bind_partitions (void);
+static void pgbuf_numa_bind_table (char *table, size_t entry_size, OS_LARGE_PAGE_TYPE page_type,
+				   const char *table_name);
+static void *pgbuf_alloc_table_memory (size_t size, OS_LARGE_PAGE_TYPE * page_type, const char *table_name);
+static void pgbuf_free_table_memory (void *table, size_t size, OS_LARGE_PAGE_TYPE page_type);
+static PGBUF_BCB *pgbuf_get_victim_from_local_node_shared_lru (THREAD_ENTRY * thread_p);
 static int pgbuf_get_victim_candidates_from_lru (THREAD_ENTRY * thread_p, int check_count,
 						 float lru_sum_flush_priority, bool * assigned_directly);
 static PGBUF_BCB *pgbuf_get_victim (THREAD_ENTRY * thread_p);
@@ -1168,6 +1317,7 @@ STATIC_INLINE PGBUF_ZONE pgbuf_bcb_get_zone (const PGBUF_BCB * bcb) __attribute_
 STATIC_INLINE int pgbuf_bcb_get_lru_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_bcb_get_pool_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_dirty (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_change_version (PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_mark_is_flushing (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_flushing (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
@@ -1222,11 +1372,43 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::daemon *pgbuf_Read_ahead_daemon = NULL;
 // *INDENT-ON*
 #endif /* SERVER_MODE */
 
 static bool pgbuf_is_page_flush_daemon_available ();
 
+static bool pgbuf_is_read_ahead_allowed (void);
+static bool pgbuf_read_ahead_request (THREAD_ENTRY * thread_p, const VPID * vpid, int npages);
+static int pgbuf_read_ahead_execute (THREAD_ENTRY * thread_p, const PGBUF_READ_AHEAD_REQUEST * request);
+static int pgbuf_read_ahead_trim_to_reserved (THREAD_ENTRY * thread_p, const VPID * vpid, int npages);
+static PGBUF_BCB *pgbuf_read_ahead_claim_bcb (THREAD_ENTRY * thread_p, const VPID * vpid, int run_index);
+static bool pgbuf_read_ahead_load_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, const char *io_page);
+
+static int pgbuf_initialize_bulk_read_rings (void);
+static void pgbuf_finalize_bulk_read_rings (void);
+STATIC_INLINE PGBUF_BULK_READ_RING *pgbuf_get_bulk_read_ring (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
+static PGBUF_BCB *pgbuf_bulk_read_ring_get_victim (THREAD_ENTRY * thread_p, PGBUF_BULK_READ_RING * ring);
+static void pgbuf_bulk_read_ring_admit (THREAD_ENTRY * thread_p, PGBUF_BULK_READ_RING * ring, PGBUF_BCB * bufptr);
+
+static int pgbuf_initialize_compressed_cache (void);
+static void pgbuf_finalize_compressed_cache (void);
+STATIC_INLINE PGBUF_COMPRESSED_CACHE_BUCKET *pgbuf_compressed_cache_get_bucket (const VPID * vpid)
+  __attribute__ ((ALWAYS_INLINE));
+static void pgbuf_compressed_cache_unlink (PGBUF_COMPRESSED_CACHE_BUCKET * bucket, PGBUF_COMPRESSED_PAGE * cpage);
+static void pgbuf_compressed_cache_free_page (PGBUF_COMPRESSED_PAGE * cpage);
+static void pgbuf_compressed_cache_store (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
+static bool pgbuf_compressed_cache_load (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * iopage);
+static void pgbuf_compressed_cache_remove (const VPID * vpid);
+static void pgbuf_compressed_cache_remove_volume (VOLID volid);
+static void pgbuf_compressed_cache_evict (THREAD_ENTRY * thread_p);
+
+#if defined (SERVER_MODE)
+static int pgbuf_warmup_compare_vpid (const void *a, const void *b);
+static void pgbuf_warmup_start (THREAD_ENTRY * thread_p);
+static void pgbuf_warmup_execute (THREAD_ENTRY * thread_p);
+#endif /* SERVER_MODE */
+
 /*
  * pgbuf_hash_func_mirror () - Hash VPID into hash anchor
  *   return: hash value
@@ -1350,6 +1532,8 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  pgbuf_initialize_numa ();
+
   if (pgbuf_initialize_bcb_table () != NO_ERROR)
     {
       goto error;
@@ -1464,6 +1648,16 @@ pgbuf_initialize (void)
       ASSERT_ERROR ();
       goto error;
     }
+
+  /* *INDENT-OFF* */
+  pgbuf_Pool.read_ahead_requests =
+    new lockfree::circular_queue<PGBUF_READ_AHEAD_REQUEST> (PGBUF_READ_AHEAD_REQUESTS_BUFFER_SIZE);
+  /* *INDENT-ON* */
+  if (pgbuf_Pool.read_ahead_requests == NULL)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
 #endif /* SERVER_MODE */
 
   if (PGBUF_PAGE_QUOTA_IS_ENABLED)
@@ -1496,6 +1690,24 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  pgbuf_Pool.read_ahead_io_area = (char *) fileio_alloc_aligned ((size_t) PGBUF_READ_AHEAD_MAX_PAGES * IO_PAGESIZE);
+  if (pgbuf_Pool.read_ahead_io_area == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) PGBUF_READ_AHEAD_MAX_PAGES * IO_PAGESIZE);
+      goto error;
+    }
+
+  if (pgbuf_initialize_bulk_read_rings () != NO_ERROR)
+    {
+      goto error;
+    }
+
+  if (pgbuf_initialize_compressed_cache () != NO_ERROR)
+    {
+      goto error;
+    }
+
   pgbuf_Pool.show_status = (PGBUF_STATUS *) malloc (sizeof (PGBUF_STATUS) * (MAX_NTRANS + 1));
   if (pgbuf_Pool.show_status == NULL)
     {
@@ -1563,14 +1775,18 @@ pgbuf_finalize (void)
 	  bufptr = PGBUF_FIND_BCB_PTR (i);
 	  pthread_mutex_destroy (&bufptr->mutex);
 	}
-      free_and_init (pgbuf_Pool.BCB_table);
-      pgbuf_Pool.num_buffers = 0;
+      pgbuf_free_table_memory (pgbuf_Pool.BCB_table, (size_t) pgbuf_Pool.num_buffers * PGBUF_BCB_SIZEOF,
+			       pgbuf_Pool.BCB_table_page_type);
+      pgbuf_Pool.BCB_table = NULL;
     }
 
   if (pgbuf_Pool.iopage_table != NULL)
     {
-      free_and_init (pgbuf_Pool.iopage_table);
+      pgbuf_free_table_memory (pgbuf_Pool.iopage_table, (size_t) pgbuf_Pool.num_buffers * PGBUF_IOPAGE_BUFFER_SIZE,
+			       pgbuf_Pool.iopage_table_page_type);
+      pgbuf_Pool.iopage_table = NULL;
     }
+  pgbuf_Pool.num_buffers = 0;
 
   /* final task for LRU list */
   if (pgbuf_Pool.buf_LRU_list != NULL)
@@ -1684,6 +1900,11 @@ pgbuf_finalize (void)
       delete pgbuf_Pool.flushed_bcbs;
       pgbuf_Pool.flushed_bcbs = NULL;
     }
+  if (pgbuf_Pool.read_ahead_requests != NULL)
+    {
+      delete pgbuf_Pool.read_ahead_requests;
+      pgbuf_Pool.read_ahead_requests = NULL;
+    }
 #endif /* SERVER_MODE */
 
   if (pgbuf_Pool.private_lrus_with_victims != NULL)
@@ -1702,6 +1923,22 @@ pgbuf_finalize (void)
       pgbuf_Pool.shared_lrus_with_victims = NULL;
     }
 
+  if (pgbuf_Pool.read_ahead_io_area != NULL)
+    {
+      fileio_free_aligned (pgbuf_Pool.read_ahead_io_area);
+      pgbuf_Pool.read_ahead_io_area = NULL;
+    }
+
+  pgbuf_finalize_bulk_read_rings ();
+  pgbuf_finalize_compressed_cache ();
+
+#if defined (SERVER_MODE)
+  if (pgbuf_Pool.warmup.vpids != NULL)
+    {
+      free_and_init (pgbuf_Pool.warmup.vpids);
+    }
+#endif /* SERVER_MODE */
+
   if (pgbuf_Pool.show_status != NULL)
     {
       free (pgbuf_Pool.show_status);
@@ -2007,7 +2244,7 @@ try_again:
       perf.holder_wait_time = perf.tv_diff.tv_sec * 1000000LL + perf.tv_diff.tv_usec;
     }
 
-  assert (bufptr == bufptr->iopage_buffer->bcb);
+  assert (bufptr == PGBUF_FIND_BCB_OF_IOPAGE (bufptr->iopage_buffer));
 
   /* In case of NO_ERROR, bufptr->mutex has been released. */
 
@@ -2169,6 +2406,83 @@ try_again:
   return pgptr;
 }
 
+/*
+ * pgbuf_read_optimistic () - Copy a resident page without fixing it
+ *   return: pointer to the page in copy area, or NULL if the page cannot be read optimistically
+ *   vpid(in): page identifier
+ *   copy_area(in): area of IO_PAGESIZE bytes the page is copied to
+ *   read_p(out): optimistic read, used to validate it later
+ *
+ * Note: No mutex is taken and the fix count of page is not changed. The page is copied only if it is in buffer and it
+ *       is not write latched, and the copy is returned only if the page did not change while being copied. A NULL
+ *       return is not an error, the caller should fix the page instead.
+ *
+ *       The copy is consistent, but it may become obsolete once it is returned. The caller that depends on the page
+ *       not being changed (e.g. to follow a pointer it read) must call pgbuf_is_optimistic_read_valid () afterwards.
+ *       Only pages that are modified under write latch can be read this way.
+ */
+PAGE_PTR
+pgbuf_read_optimistic (THREAD_ENTRY * thread_p, const VPID * vpid, char *copy_area, PGBUF_OPTIMISTIC_READ * read_p)
+{
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+
+  assert (vpid != NULL && !VPID_ISNULL (vpid));
+  assert (copy_area != NULL && read_p != NULL);
+
+  /* BCB's are never freed, it is safe to walk the chain while it is being changed. */
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
+  for (bufptr = hash_anchor->hash_next; bufptr != NULL; bufptr = bufptr->hash_next)
+    {
+      if (VPID_EQ (&bufptr->vpid, vpid))
+	{
+	  break;
+	}
+    }
+  if (bufptr == NULL)
+    {
+      /* not in buffer */
+      return NULL;
+    }
+
+  read_p->version = bufptr->version;
+  MEMORY_BARRIER ();
+  if ((read_p->version & 1) != 0 || bufptr->latch_mode == PGBUF_LATCH_WRITE || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      /* replaced or being modified */
+      return NULL;
+    }
+
+  memcpy (copy_area, &bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+
+  CAST_BFPTR_TO_PGPTR (read_p->pgptr, bufptr);
+  VPID_COPY (&read_p->vpid, vpid);
+  if (!pgbuf_is_optimistic_read_valid (read_p))
+    {
+      /* changed while being copied */
+      return NULL;
+    }
+
+  return (PAGE_PTR) ((FILEIO_PAGE *) copy_area)->page;
+}
+
+/*
+ * pgbuf_is_optimistic_read_valid () - Check that the page read by pgbuf_read_optimistic () was not changed or
+ *                                     replaced since
+ *   return: true if the page is unchanged, false otherwise
+ *   read_p(in): optimistic read
+ */
+bool
+pgbuf_is_optimistic_read_valid (const PGBUF_OPTIMISTIC_READ * read_p)
+{
+  PGBUF_BCB *bufptr;
+
+  CAST_PGPTR_TO_BFPTR (bufptr, read_p->pgptr);
+
+  MEMORY_BARRIER ();
+  return bufptr->version == read_p->version && VPID_EQ (&bufptr->vpid, &read_p->vpid);
+}
+
 /*
  * pgbuf_promote_read_latch () - Promote read latch to write latch
  *   return: error code or NO_ERROR
@@ -2297,6 +2611,7 @@ pgbuf_promote_read_latch_release (THREAD_ENTRY * thread_p, PAGE_PTR * pgptr_p, P
 
       /* we're the single holder of the read latch, do an in-place promotion */
       bufptr->latch_mode = PGBUF_LATCH_WRITE;
+      pgbuf_bcb_change_version (bufptr);
       holder->perf_stat.hold_has_write_latch = 1;
       /* NOTE: no need to set the promoted flag as long as we don't wait */
       PGBUF_BCB_UNLOCK (bufptr);
@@ -2410,6 +2725,7 @@ end:
 
 #else /* SERVER_MODE */
   bufptr->latch_mode = PGBUF_LATCH_WRITE;
+  pgbuf_bcb_change_version (bufptr);
   return NO_ERROR;
 #endif
 }
@@ -2842,6 +3158,9 @@ pgbuf_invalidate_all (THREAD_ENTRY * thread_p, VOLID volid)
   VPID temp_vpid;
   int bufid;
 
+  /* cached images of pages that are no longer in buffer are dropped too; the volume may be reused */
+  pgbuf_compressed_cache_remove_volume (volid);
+
   /*
    * While searching all the buffer pages or corresponding buffer pages,
    * the caller flushes each buffer page if it is dirty and
@@ -3530,6 +3849,9 @@ end:
  * Note: The function flushes and dirty unfixed page whose LSA is smaller that the last_chkpt_lsa,
  *       it returns the smallest_lsa from the remaining dirty buffers which were not flushed.
  *       This function is used by the log and recovery manager when a checkpoint is issued.
+ *
+ *       Dirty pages newer than flush_upto_lsa are left alone but still count for smallest_lsa, so an incremental
+ *       checkpoint may pass an older flush_upto_lsa and only flush the oldest part of the buffer pool.
  */
 int
 pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa, const LOG_LSA * prev_chkpt_redo_lsa,
@@ -3598,10 +3920,19 @@ pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
       PGBUF_BCB_LOCK (bufptr);
 
       /* flush condition check */
-      if (!pgbuf_bcb_is_dirty (bufptr)
-	  || (!LSA_ISNULL (&bufptr->oldest_unflush_lsa) && LSA_GT (&bufptr->oldest_unflush_lsa, flush_upto_lsa))
-	  || pgbuf_is_temporary_volume (bufptr->vpid.volid))
+      if (!pgbuf_bcb_is_dirty (bufptr) || pgbuf_is_temporary_volume (bufptr->vpid.volid))
+	{
+	  PGBUF_BCB_UNLOCK (bufptr);
+	  continue;
+	}
+
+      if (!LSA_ISNULL (&bufptr->oldest_unflush_lsa) && LSA_GT (&bufptr->oldest_unflush_lsa, flush_upto_lsa))
 	{
+	  /* newer than what we flush. the page stays dirty, so the redo point cannot go beyond it. */
+	  if (LSA_ISNULL (smallest_lsa) || LSA_LT (&bufptr->oldest_unflush_lsa, smallest_lsa))
+	    {
+	      LSA_COPY (smallest_lsa, &bufptr->oldest_unflush_lsa);
+	    }
 	  PGBUF_BCB_UNLOCK (bufptr);
 	  continue;
 	}
@@ -4899,6 +5230,164 @@ pgbuf_is_temporary_volume (VOLID volid)
   return xdisk_get_purpose (NULL, volid) == DB_TEMPORARY_DATA_PURPOSE;
 }
 
+/*
+ * pgbuf_initialize_numa () - decide the NUMA partitions of page buffer
+ *
+ * return : void
+ *
+ * note: the pool is split in one partition of contiguous buffers per NUMA node. each shared lru list is assigned to a
+ *       node and holds only buffers of the node.
+ */
+static void
+pgbuf_initialize_numa (void)
+{
+  int numa_nodes;
+
+  pgbuf_Pool.numa_nodes = 1;
+  pgbuf_Pool.numa_victim_cursor = 0;
+
+  if (!prm_get_bool_value (PRM_ID_PB_NUMA_AWARE))
+    {
+      return;
+    }
+
+  numa_nodes = os_numa_get_node_count ();
+  if (numa_nodes <= 1)
+    {
+      /* not a NUMA system */
+      return;
+    }
+  if (numa_nodes > PGBUF_SHARED_LRU_COUNT || numa_nodes > pgbuf_Pool.num_buffers / PGBUF_MINIMUM_BUFFERS)
+    {
+      er_log_debug (ARG_FILE_LINE, "pgbuf_initialize_numa: buffer is too small for %d NUMA nodes.\n", numa_nodes);
+      return;
+    }
+
+  pgbuf_Pool.numa_nodes = numa_nodes;
+}
+
+/*
+ * pgbuf_numa_bind_partitions () - place the memory of each buffer partition on its NUMA node
+ *
+ * return : void
+ */
+static void
+pgbuf_numa_bind_partitions (void)
+{
+  if (pgbuf_Pool.numa_nodes <= 1)
+    {
+      return;
+    }
+
+  pgbuf_numa_bind_table ((char *) pgbuf_Pool.BCB_table, PGBUF_BCB_SIZEOF, pgbuf_Pool.BCB_table_page_type,
+			 "BCB table");
+  pgbuf_numa_bind_table ((char *) pgbuf_Pool.iopage_table, PGBUF_IOPAGE_BUFFER_SIZE,
+			 pgbuf_Pool.iopage_table_page_type, "IO page table");
+}
+
+/*
+ * pgbuf_numa_bind_table () - place the partitions of a buffer table on their NUMA nodes
+ *
+ * return          : void
+ * table (in)      : table memory
+ * entry_size (in) : size of the table entry of one buffer
+ * page_type (in)  : pages backing the table
+ * table_name (in) : table name for the report
+ *
+ * note: memory can only be placed in units of the pages backing it. partition boundaries are rounded to the nearest
+ *       page boundary, so that with huge pages the partitions still cover the table and at most one page around each
+ *       boundary goes to the neighbour node.
+ */
+static void
+pgbuf_numa_bind_table (char *table, size_t entry_size, OS_LARGE_PAGE_TYPE page_type, const char *table_name)
+{
+  size_t page_size = os_large_page_size (page_type);
+  size_t table_size = (size_t) pgbuf_Pool.num_buffers * entry_size;
+  size_t start_offset, end_offset;
+  int node;
+  int end_bufid;
+
+  start_offset = 0;
+  for (node = 0; node < pgbuf_Pool.numa_nodes; node++)
+    {
+      if (node == pgbuf_Pool.numa_nodes - 1)
+	{
+	  /* a mapping is rounded up to its page size; other memory may be shared with the next allocation */
+	  end_offset = (page_type != OS_LARGE_PAGE_NONE) ? ((table_size + page_size - 1) / page_size) * page_size
+	    : (table_size / page_size) * page_size;
+	}
+      else
+	{
+	  /* first buffer of next node, see PGBUF_NUMA_NODE_OF_BUFFER */
+	  end_bufid =
+	    (int) (((INT64) (node + 1) * pgbuf_Pool.num_buffers + pgbuf_Pool.numa_nodes - 1) / pgbuf_Pool.numa_nodes);
+	  assert (PGBUF_NUMA_NODE_OF_BUFFER (end_bufid - 1) == node && PGBUF_NUMA_NODE_OF_BUFFER (end_bufid) == node + 1);
+	  end_offset = (((size_t) end_bufid * entry_size + page_size / 2) / page_size) * page_size;
+	}
+
+      if (end_offset > start_offset && os_numa_bind_memory (table + start_offset, end_offset - start_offset, node) != 0)
+	{
+	  /* not fatal; memory is placed by the system */
+	  er_set_with_oserror (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_PB_NUMA_BIND_FAILED, 2, table_name, node);
+	}
+      start_offset = MAX (start_offset, end_offset);
+    }
+}
+
+/*
+ * pgbuf_alloc_table_memory () - allocate memory for a large table of page buffer
+ *
+ * return          : memory aligned for direct I/O, or NULL
+ * size (in)       : size of table
+ * page_type (out) : pages backing the table; give it back to pgbuf_free_table_memory
+ * table_name (in) : table name for the boot report
+ *
+ * note: with use_huge_pages, the table is backed by huge pages when the system can provide them. what was obtained
+ *       is reported to the error log.
+ */
+static void *
+pgbuf_alloc_table_memory (size_t size, OS_LARGE_PAGE_TYPE * page_type, const char *table_name)
+{
+  void *table = NULL;
+
+  *page_type = OS_LARGE_PAGE_NONE;
+
+  if (prm_get_bool_value (PRM_ID_USE_HUGE_PAGES))
+    {
+      table = os_alloc_large_pages (size, page_type);
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_PB_TABLE_PAGE_TYPE, 3, table_name, (long long) size,
+	      os_large_page_type_name (table != NULL ? *page_type : OS_LARGE_PAGE_NONE));
+    }
+  if (table == NULL)
+    {
+      *page_type = OS_LARGE_PAGE_NONE;
+      table = fileio_alloc_aligned (size);
+    }
+
+  return table;
+}
+
+/*
+ * pgbuf_free_table_memory () - free memory allocated by pgbuf_alloc_table_memory
+ *
+ * return         : void
+ * table (in)     : table memory
+ * size (in)      : size of table
+ * page_type (in) : pages backing the table
+ */
+static void
+pgbuf_free_table_memory (void *table, size_t size, OS_LARGE_PAGE_TYPE page_type)
+{
+  if (page_type == OS_LARGE_PAGE_NONE)
+    {
+      fileio_free_aligned (table);
+    }
+  else
+    {
+      os_free_large_pages (table, size, page_type);
+    }
+}
+
 /*
  * pgbuf_init_BCB_table () - Initializes page buffer BCB table
  *   return: NO_ERROR, or ER_code
@@ -4918,7 +5407,9 @@ pgbuf_initialize_bcb_table (void)
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, "data_buffer_pages");
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.BCB_table = (PGBUF_BCB *) malloc ((size_t) alloc_size);
+  pgbuf_Pool.BCB_table =
+    (PGBUF_BCB *) pgbuf_alloc_table_memory ((size_t) alloc_size, &pgbuf_Pool.BCB_table_page_type,
+					    "Page buffer BCB table");
   if (pgbuf_Pool.BCB_table == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
@@ -4930,23 +5421,26 @@ pgbuf_initialize_bcb_table (void)
   if (!MEM_SIZE_IS_VALID (alloc_size))
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, "data_buffer_pages");
-      if (pgbuf_Pool.BCB_table != NULL)
-	{
-	  free_and_init (pgbuf_Pool.BCB_table);
-	}
+      pgbuf_free_table_memory (pgbuf_Pool.BCB_table, (size_t) pgbuf_Pool.num_buffers * PGBUF_BCB_SIZEOF,
+			       pgbuf_Pool.BCB_table_page_type);
+      pgbuf_Pool.BCB_table = NULL;
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) malloc ((size_t) alloc_size);
+  pgbuf_Pool.iopage_table =
+    (PGBUF_IOPAGE_BUFFER *) pgbuf_alloc_table_memory ((size_t) alloc_size, &pgbuf_Pool.iopage_table_page_type,
+						      "Page buffer IO page table");
   if (pgbuf_Pool.iopage_table == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
-      if (pgbuf_Pool.BCB_table != NULL)
-	{
-	  free_and_init (pgbuf_Pool.BCB_table);
-	}
+      pgbuf_free_table_memory (pgbuf_Pool.BCB_table, (size_t) pgbuf_Pool.num_buffers * PGBUF_BCB_SIZEOF,
+			       pgbuf_Pool.BCB_table_page_type);
+      pgbuf_Pool.BCB_table = NULL;
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
 
+  /* place partitions on their nodes before memory is touched */
+  pgbuf_numa_bind_partitions ();
+
   /* initialize each entry of the buffer BCB table */
   for (i = 0; i < pgbuf_Pool.num_buffers; i++)
     {
@@ -4978,6 +5472,7 @@ pgbuf_initialize_bcb_table (void)
       bufptr->flags = PGBUF_BCB_INIT_FLAGS;
       bufptr->count_fix_and_avoid_dealloc = 0;
       bufptr->hit_age = 0;
+      bufptr->version = 1;	/* not in hash chain */
       LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
 
       bufptr->tick_lru3 = 0;
@@ -4999,7 +5494,6 @@ pgbuf_initialize_bcb_table (void)
       ioptr->iopage.prv.tde_nonce = 0;
 
       bufptr->iopage_buffer = ioptr;
-      ioptr->bcb = bufptr;
 
 #if defined(CUBRID_DEBUG)
       /* Reinitizalize the buffer */
@@ -5033,6 +5527,7 @@ pgbuf_initialize_hash_table (void)
   for (i = 0; i < hashsize; i++)
     {
       pthread_mutex_init (&pgbuf_Pool.buf_hash_table[i].hash_mutex, NULL);
+      pgbuf_Pool.buf_hash_table[i].version = 0;
       pgbuf_Pool.buf_hash_table[i].hash_next = NULL;
       pgbuf_Pool.buf_hash_table[i].lock_next = NULL;
     }
@@ -5060,6 +5555,10 @@ pgbuf_initialize_lock_table (void)
 #endif /* !SERVER_MODE */
 
   alloc_size = thrd_num_total * PGBUF_BUFFER_LOCK_SIZEOF;
+#if defined(SERVER_MODE)
+  /* entries reserved for read-ahead */
+  alloc_size += PGBUF_READ_AHEAD_MAX_PAGES * PGBUF_BUFFER_LOCK_SIZEOF;
+#endif /* SERVER_MODE */
   pgbuf_Pool.buf_lock_table = (PGBUF_BUFFER_LOCK *) malloc (alloc_size);
   if (pgbuf_Pool.buf_lock_table == NULL)
     {
@@ -5068,7 +5567,7 @@ pgbuf_initialize_lock_table (void)
     }
 
   /* initialize each entry of the buffer lock table */
-  for (i = 0; i < thrd_num_total; i++)
+  for (i = 0; i < alloc_size / PGBUF_BUFFER_LOCK_SIZEOF; i++)
     {
       VPID_SET_NULL (&pgbuf_Pool.buf_lock_table[i].vpid);
       pgbuf_Pool.buf_lock_table[i].lock_next = NULL;
@@ -5608,6 +6107,10 @@ pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_
 
   bufptr->latch_mode = request_mode;
   bufptr->fcnt = 1;
+  if (request_mode == PGBUF_LATCH_WRITE)
+    {
+      pgbuf_bcb_change_version (bufptr);
+    }
 
   PGBUF_BCB_UNLOCK (bufptr);
 
@@ -5855,6 +6358,7 @@ pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LAT
       if (bufptr->fcnt == holder->fix_count)
 	{
 	  bufptr->latch_mode = request_mode;	/* PGBUF_LATCH_WRITE */
+	  pgbuf_bcb_change_version (bufptr);
 	  bufptr->fcnt++;
 	  assert (0 < bufptr->fcnt);
 
@@ -6314,7 +6818,7 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
       /* fall through to add to shared */
     }
   /* add to middle of shared list. */
-  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add ());
+  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add (bcb));
   perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_SHARED_MID);
   if (!PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
     {
@@ -6811,6 +7315,10 @@ pgbuf_wakeup_reader_writer (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 	    {
 	      /* grant the request */
 	      bufptr->latch_mode = (PGBUF_LATCH_MODE) thrd_entry->request_latch_mode;
+	      if (bufptr->latch_mode == PGBUF_LATCH_WRITE)
+		{
+		  pgbuf_bcb_change_version (bufptr);
+		}
 	      bufptr->fcnt += thrd_entry->request_fix_count;
 
 	      /* do not handle BCB holder entry, at here. refer pgbuf_latch_bcb_upon_fix () */
@@ -6871,12 +7379,26 @@ pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_ancho
 #if defined(SERVER_MODE)
   int rv;
 #endif
+  int version;
+  int retry_count = 0;
   TSC_TICKS start_tick, end_tick;
   UINT64 lock_wait_time = 0;
 
 /* one_phase: no hash-chain mutex */
 one_phase:
 
+  /* BCB's are never freed, it is safe to walk the chain while it is being changed. A BCB found by the walk is
+   * validated under its own mutex. A miss is trusted only if the chain did not change during the walk; otherwise the
+   * BCB may have been skipped and the walk is repeated. */
+  version = hash_anchor->version;
+  MEMORY_BARRIER ();
+  if (version & 1)
+    {
+      /* the chain is being changed */
+      bufptr = NULL;
+      goto retry_one_phase;
+    }
+
   bufptr = hash_anchor->hash_next;
   while (bufptr != NULL)
     {
@@ -6918,13 +7440,26 @@ one_phase:
 
   if (bufptr != NULL)
     {
+      perfmon_inc_stat (thread_p, PSTAT_PB_HASH_OPTIMISTIC_HITS);
       return bufptr;
     }
 
-#if defined(SERVER_MODE)
+  MEMORY_BARRIER ();
+  if (hash_anchor->version == version)
+    {
+      /* the page is not in the buffer. hash_mutex is needed to lock the page. */
+      goto two_phase;
+    }
+
+retry_one_phase:
+  if (++retry_count <= PGBUF_HASH_OPTIMISTIC_MAX_RETRIES)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_HASH_OPTIMISTIC_RETRIES);
+      goto one_phase;
+    }
+
 /* two_phase: hold hash-chain mutex */
 two_phase:
-#endif
 
 try_again:
 
@@ -7027,8 +7562,15 @@ pgbuf_insert_into_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_
       perfmon_add_stat (thread_p, PSTAT_PB_TIME_HASH_ANCHOR_WAIT, lock_wait_time);
     }
 
+  /* the page of BCB is loaded and latched, it can be read optimistically once published */
+  ATOMIC_INC_32 (&bufptr->version, 1);
+
+  /* readers walk the chain without hash_mutex; bufptr->hash_next must be set before bufptr is published */
+  ATOMIC_INC_32 (&hash_anchor->version, 1);
   bufptr->hash_next = hash_anchor->hash_next;
+  MEMORY_BARRIER ();
   hash_anchor->hash_next = bufptr;
+  ATOMIC_INC_32 (&hash_anchor->version, 1);
 
   /*
    * hash_anchor->hash_mutex is not released at this place.
@@ -7120,6 +7662,7 @@ pgbuf_delete_from_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 	}
 
       /* disconnect the BCB from the buffer hash chain */
+      ATOMIC_INC_32 (&hash_anchor->version, 1);
       if (prev_bufptr == NULL)
 	{
 	  hash_anchor->hash_next = curr_bufptr->hash_next;
@@ -7130,7 +7673,10 @@ pgbuf_delete_from_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 	}
 
       curr_bufptr->hash_next = NULL;
+      ATOMIC_INC_32 (&hash_anchor->version, 1);
       pthread_mutex_unlock (&hash_anchor->hash_mutex);
+      /* the BCB is not published anymore */
+      ATOMIC_INC_32 (&bufptr->version, 1);
       VPID_SET_NULL (&(bufptr->vpid));
       pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
 
@@ -7532,6 +8078,9 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
 end:
   if (bufptr != NULL)
     {
+      /* keep a compressed image of the page while it can still be found in buffer */
+      pgbuf_compressed_cache_store (thread_p, bufptr);
+
       /* victimize the buffer */
       if (pgbuf_victimize_bcb (thread_p, bufptr) != NO_ERROR)
 	{
@@ -7573,6 +8122,8 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   bool success;
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   PGBUF_STATUS *show_status = &pgbuf_Pool.show_status[tran_index];
+  PGBUF_BULK_READ_RING *ring = NULL;
+  bool is_compressed_cache_hit = false;
 
 #if defined (ENABLE_SYSTEMTAP)
   bool monitored = false;
@@ -7625,7 +8176,19 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
     }
 
   /* Now, the caller is not holding any mutex. */
-  bufptr = pgbuf_allocate_bcb (thread_p, vpid);
+  if (fetch_mode != NEW_PAGE)
+    {
+      ring = pgbuf_get_bulk_read_ring (thread_p);
+    }
+  if (ring != NULL)
+    {
+      /* large sequential scan; recycle its own oldest buffer before victimizing pages of others */
+      bufptr = pgbuf_bulk_read_ring_get_victim (thread_p, ring);
+    }
+  if (bufptr == NULL)
+    {
+      bufptr = pgbuf_allocate_bcb (thread_p, vpid);
+    }
   if (bufptr == NULL)
     {
       ASSERT_ERROR ();
@@ -7646,9 +8209,13 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 
   if (fetch_mode != NEW_PAGE)
     {
-      /* Record number of reads in statistics */
-      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
-      show_status->num_pages_read++;
+      is_compressed_cache_hit = pgbuf_compressed_cache_load (thread_p, vpid, &bufptr->iopage_buffer->iopage);
+      if (!is_compressed_cache_hit)
+	{
+	  /* Record number of reads in statistics */
+	  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
+	  show_status->num_pages_read++;
+	}
 
 #if defined(ENABLE_SYSTEMTAP)
       query_id = qmgr_get_current_query_id (thread_p);
@@ -7659,7 +8226,11 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	}
 #endif /* ENABLE_SYSTEMTAP */
 
-      if (dwb_read_page (thread_p, vpid, &bufptr->iopage_buffer->iopage, &success) != NO_ERROR)
+      if (is_compressed_cache_hit)
+	{
+	  /* Nothing to do, decompressed from compressed cache */
+	}
+      else if (dwb_read_page (thread_p, vpid, &bufptr->iopage_buffer->iopage, &success) != NO_ERROR)
 	{
 	  /* Should not happen */
 	  assert (false);
@@ -7698,7 +8269,8 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 
       CAST_IOPGPTR_TO_PGPTR (pgptr, &bufptr->iopage_buffer->iopage);
       tde_algo = pgbuf_get_tde_algorithm (pgptr);
-      if (tde_algo != TDE_ALGORITHM_NONE)
+      /* compressed cache keeps decrypted images */
+      if (tde_algo != TDE_ALGORITHM_NONE && !is_compressed_cache_hit)
 	{
 	  if (tde_decrypt_data_page
 	      (&bufptr->iopage_buffer->iopage, tde_algo, pgbuf_is_temporary_volume (vpid->volid),
@@ -7747,11 +8319,19 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	{
 	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_IO_PAGES);
 	}
+
+      if (ring != NULL)
+	{
+	  pgbuf_bulk_read_ring_admit (thread_p, ring, bufptr);
+	}
     }
   else
     {
       /* the caller is holding bufptr->mutex */
 
+      /* an image of a previous incarnation of the page must not be loaded later */
+      pgbuf_compressed_cache_remove (vpid);
+
 #if defined(CUBRID_DEBUG)
       pgbuf_scramble (&bufptr->iopage_buffer->iopage);
 #endif /* CUBRID_DEBUG */
@@ -8110,10 +8690,11 @@ pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
  * pgbuf_get_shared_lru_index_for_add () - get a shared index to add a new bcb. we'll use a round-robin way to choose
  *                                         next list, but we'll avoid biggest list (just to keep things balanced).
  *
- * return : shared lru index
+ * return   : shared lru index
+ * bcb (in) : bcb to add. with NUMA-aware buffer, only a list of its node can be chosen.
  */
 STATIC_INLINE int
-pgbuf_get_shared_lru_index_for_add (void)
+pgbuf_get_shared_lru_index_for_add (const PGBUF_BCB * bcb)
 {
 #define PAGE_ADD_REFRESH_STAT \
   MAX (2 * pgbuf_Pool.num_buffers / PGBUF_SHARED_LRU_COUNT, 10000)
@@ -8181,17 +8762,72 @@ pgbuf_get_shared_lru_index_for_add (void)
       lru_idx = lru_idx % PGBUF_SHARED_LRU_COUNT;
     }
 
+  if (pgbuf_Pool.numa_nodes > 1)
+    {
+      /* use the list of buffer node next to the chosen list */
+      lru_idx = lru_idx - lru_idx % pgbuf_Pool.numa_nodes
+	+ PGBUF_NUMA_NODE_OF_BUFFER (pgbuf_bcb_get_pool_index (bcb));
+      if ((int) lru_idx >= PGBUF_SHARED_LRU_COUNT)
+	{
+	  lru_idx -= pgbuf_Pool.numa_nodes;
+	}
+    }
+
   return lru_idx;
 #undef PAGE_ADD_REFRESH_STAT
 }
 
 /*
- * pgbuf_get_victim () - get a victim bcb from page buffer.
+ * pgbuf_get_victim_from_local_node_shared_lru () - get a victim from the shared lists of the NUMA node that runs
+ *                                                  current thread.
  *
- * return        : victim candidate or NULL if no candidate was found
+ * return        : victim or NULL
  * thread_p (in) : thread entry
  *
- * Note: If a victim BCB is found, this function will already lock it. This means that the caller will have exclusive
+ * note: lists are visited directly, without consuming them from the queue of shared lists with victims. lists left
+ *       without victims are removed from the queue by next consumers.
+ */
+static PGBUF_BCB *
+pgbuf_get_victim_from_local_node_shared_lru (THREAD_ENTRY * thread_p)
+{
+  PGBUF_BCB *victim;
+  int node;
+  int node_list_count;
+  int lru_idx;
+  int i;
+  unsigned int start;
+
+  assert (pgbuf_Pool.numa_nodes > 1);
+
+  node = os_numa_get_current_node () % pgbuf_Pool.numa_nodes;
+  node_list_count = (PGBUF_SHARED_LRU_COUNT - node + pgbuf_Pool.numa_nodes - 1) / pgbuf_Pool.numa_nodes;
+
+  start = ATOMIC_INC_32 (&pgbuf_Pool.numa_victim_cursor, 1);
+  for (i = 0; i < node_list_count; i++)
+    {
+      lru_idx = node + (int) ((start + i) % node_list_count) * pgbuf_Pool.numa_nodes;
+      if (PGBUF_GET_LRU_LIST (lru_idx)->count_vict_cand <= 0)
+	{
+	  continue;
+	}
+      victim = pgbuf_get_victim_from_lru_list (thread_p, lru_idx);
+      if (victim != NULL)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_PB_VICTIM_LOCAL_NODE_SHARED_LRU_SUCCESS);
+	  return victim;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * pgbuf_get_victim () - get a victim bcb from page buffer.
+ *
+ * return        : victim candidate or NULL if no candidate was found
+ * thread_p (in) : thread entry
+ *
+ * Note: If a victim BCB is found, this function will already lock it. This means that the caller will have exclusive
  *       access to the returned BCB.
  */
 static PGBUF_BCB *
@@ -8320,6 +8956,21 @@ pgbuf_get_victim (THREAD_ENTRY * thread_p)
       PERF_UTIME_TRACKER_START (thread_p, &perf_tracker);
     }
 
+  if (pgbuf_Pool.numa_nodes > 1)
+    {
+      /* 3. with NUMA-aware buffer, first search the shared lists of the node running this thread. their buffers are in
+       *    local memory. */
+      victim = pgbuf_get_victim_from_local_node_shared_lru (thread_p);
+      if (victim != NULL)
+	{
+	  if (detailed_perf)
+	    {
+	      PERF_UTIME_TRACKER_TIME (thread_p, &perf_tracker, PSTAT_PB_VICTIM_SEARCH_SHARED_LISTS);
+	    }
+	  return victim;
+	}
+    }
+
   initial_consume_cursor = pgbuf_Pool.shared_lrus_with_victims->get_consumer_cursor ();
   do
     {
@@ -9463,7 +10114,7 @@ pgbuf_lru_move_from_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   pgbuf_lru_remove_bcb (thread_p, bcb);
 
   /* add bcb to middle of shared list */
-  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add ());
+  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add (bcb));
 
   pgbuf_bcb_register_hit_for_lru (bcb);
 }
@@ -9557,7 +10208,7 @@ pgbuf_move_bcb_to_bottom_lru (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
 	}
       else
 	{
-	  lru_idx = pgbuf_get_shared_lru_index_for_add ();
+	  lru_idx = pgbuf_get_shared_lru_index_for_add (bcb);
 	}
       pgbuf_lru_add_new_bcb_to_bottom (thread_p, bcb, lru_idx);
     }
@@ -10312,6 +10963,20 @@ pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
     }
 #endif
 
+  if (!PGBUF_IS_PAGE_IN_POOL (pgptr))
+    {
+      FILEIO_PAGE *io_pgptr;
+
+      /* page copied by pgbuf_read_optimistic (); there is no BCB to check */
+      CAST_PGPTR_TO_IOPGPTR (io_pgptr, pgptr);
+      if (io_pgptr->prv.ptype != PAGE_UNKNOWN && io_pgptr->prv.ptype != ptype)
+	{
+	  assert_release (no_error);
+	  return false;
+	}
+      return true;
+    }
+
   if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL))
     {
       if (pgbuf_is_valid_page_ptr (pgptr) == false)
@@ -14759,6 +15424,20 @@ pgbuf_bcb_is_dirty (const PGBUF_BCB * bcb)
   return (bcb->flags & PGBUF_BCB_DIRTY_FLAG) != 0;
 }
 
+/*
+ * pgbuf_bcb_change_version () - change bcb version to fail the optimistic reads in progress. must be called after
+ *                               the page is write latched and before it is modified.
+ *
+ * return   : void
+ * bcb (in) : bcb
+ */
+STATIC_INLINE void
+pgbuf_bcb_change_version (PGBUF_BCB * bcb)
+{
+  /* keep the parity, it tells whether bcb is in hash chain */
+  (void) ATOMIC_INC_32 (&bcb->version, 2);
+}
+
 /*
  * pgbuf_bcb_set_dirty () - set dirty flag to bcb
  *
@@ -15703,217 +16382,1659 @@ pgbuf_find_current_wait_msecs (THREAD_ENTRY * thread_p)
 }
 
 /*
- * pgbuf_get_page_flush_interval () - setup page flush daemon period based on system parameter
+ * pgbuf_read_ahead_init () - initialize read-ahead state of a scan
+ *
+ * return          : void
+ * read_ahead (in) : read-ahead state
  */
 void
-pgbuf_get_page_flush_interval (bool & is_timed_wait, cubthread::delta_time & period)
+pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead)
 {
-  int page_flush_interval_msecs = prm_get_integer_value (PRM_ID_PAGE_BG_FLUSH_INTERVAL_MSECS);
-
-  assert (page_flush_interval_msecs >= 0);
+  assert (read_ahead != NULL);
 
-  if (page_flush_interval_msecs > 0)
-    {
-      // if page_flush_interval_msecs > 0 (zero) then loop for fixed interval
-      is_timed_wait = true;
-      period = std::chrono::milliseconds (page_flush_interval_msecs);
-    }
-  else
-    {
-      // infinite wait
-      is_timed_wait = false;
-    }
+  VPID_SET_NULL (&read_ahead->last_vpid);
+  VPID_SET_NULL (&read_ahead->window_vpid);
+  read_ahead->window_npages = 0;
+  read_ahead->seq_count = 0;
+  read_ahead->hits = 0;
+  read_ahead->misses = 0;
 }
 
-// *INDENT-OFF*
-#if defined (SERVER_MODE)
-static void
-pgbuf_page_maintenance_execute (cubthread::entry & thread_ref)
+/*
+ * pgbuf_read_ahead_notify () - notify read-ahead that a scan is going to fix a page. once the scan is found to be
+ *                              sequential, the next window of pages is requested to be loaded in page buffer before
+ *                              the scan gets there.
+ *
+ * return          : void
+ * thread_p (in)   : thread entry
+ * read_ahead (in) : read-ahead state of scan
+ * vpid (in)       : page the scan is going to fix
+ */
+void
+pgbuf_read_ahead_notify (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * vpid)
 {
-  if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
-      {
-        return;
-      }
-
-  /* page buffer maintenance thread adjust quota's based on thread activity. */
-  pgbuf_adjust_quotas (&thread_ref);
-
-  /* search lists and assign victims directly */
-  pgbuf_direct_victims_maintenance (&thread_ref);
-}
-#endif /* SERVER_MODE */
+  int window_npages;
+  PAGEID window_end;
+  VPID next_window_vpid;
+  bool is_in_window;
 
-#if defined (SERVER_MODE)
-// class pgbuf_page_flush_daemon_task
-//
-//  description:
-//    page flush daemon task
-//
-class pgbuf_page_flush_daemon_task : public cubthread::entry_task
-{
-  private:
-    PERF_UTIME_TRACKER m_perf_track;
+  assert (read_ahead != NULL && vpid != NULL);
 
-  public:
-    pgbuf_page_flush_daemon_task ()
+  if (vpid->volid == NULL_VOLID || vpid->pageid == NULL_PAGEID)
     {
-      PERF_UTIME_TRACKER_START (NULL, &m_perf_track);
+      /* page is not on disk (e.g. list file page kept in memory buffer) */
+      return;
     }
 
-    void execute (cubthread::entry & thread_ref) override
+  if (VPID_EQ (&read_ahead->last_vpid, vpid))
     {
-      if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
-        {
-          return;
-        }
-
-      // did not timeout, someone requested flush... run at least once
-      bool force_one_run = pgbuf_Page_flush_daemon->was_woken_up ();
-      bool stop_iteration = false;
-
-      /* flush pages as long as necessary */
-      while (force_one_run || pgbuf_keep_victim_flush_thread_running ())
-	{
-	  pgbuf_flush_victim_candidates (&thread_ref, prm_get_float_value (PRM_ID_PB_BUFFER_FLUSH_RATIO), &m_perf_track,
-					 &stop_iteration);
-	  force_one_run = false;
-	  if (stop_iteration)
-	    {
-	      break;
-	    }
-	}
-
-      /* performance tracking */
-      if (m_perf_track.is_perf_tracking)
-	{
-	  /* register sleep time. */
-	  PERF_UTIME_TRACKER_TIME_AND_RESTART (&thread_ref, &m_perf_track, PSTAT_PB_FLUSH_SLEEP);
-
-	  /* update is_perf_tracking */
-	  m_perf_track.is_perf_tracking = perfmon_is_perf_tracking ();
-	}
-      else
-	{
-	  /* update is_perf_tracking and start timer if it became true */
-	  PERF_UTIME_TRACKER_START (&thread_ref, &m_perf_track);
-	}
+      /* same page is fixed again */
+      return;
     }
-};
-#endif /* SERVER_MODE */
 
-#if defined (SERVER_MODE)
-static void
-pgbuf_page_post_flush_execute (cubthread::entry & thread_ref)
-{
-  if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
+  /* sequential access is tracked even if read-ahead is disabled; it is also used for bulk read admission. */
+  if (read_ahead->last_vpid.volid == vpid->volid && vpid->pageid > read_ahead->last_vpid.pageid
+      && vpid->pageid - read_ahead->last_vpid.pageid <= PGBUF_READ_AHEAD_MAX_GAP)
     {
-      return;
+      read_ahead->seq_count++;
     }
-
-  /* assign flushed pages */
-  if (pgbuf_assign_flushed_pages (&thread_ref))
+  else
     {
-      /* reset daemon looper and be prepared to start over */
-      pgbuf_Page_post_flush_daemon->reset_looper ();
+      /* random or backward access. start over. */
+      read_ahead->seq_count = 1;
     }
-}
-#endif /* SERVER_MODE */
-
-#if defined (SERVER_MODE)
-// class pgbuf_flush_control_daemon_task
-//
-//  description:
-//    flush control daemon task
-//
-class pgbuf_flush_control_daemon_task : public cubthread::entry_task
-{
-  private:
-    struct timeval m_end;
-    bool m_first_run;
+  read_ahead->last_vpid = *vpid;
 
-  public:
-    pgbuf_flush_control_daemon_task ()
-      : m_end ({0, 0})
-      , m_first_run (true)
+  window_npages = prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES);
+  if (window_npages <= 0)
     {
+      /* read-ahead is disabled */
+      return;
     }
+  window_npages = MIN (window_npages, PGBUF_READ_AHEAD_MAX_PAGES);
 
-    int initialize ()
+  if (read_ahead->seq_count < PGBUF_READ_AHEAD_MIN_SEQUENTIAL)
     {
-      return fileio_flush_control_initialize ();
+      return;
     }
 
-    void execute (cubthread::entry & thread_ref) override
+  window_end = read_ahead->window_vpid.pageid + read_ahead->window_npages;
+  is_in_window = (read_ahead->window_npages > 0 && read_ahead->window_vpid.volid == vpid->volid
+		  && vpid->pageid >= read_ahead->window_vpid.pageid && vpid->pageid < window_end);
+  if (is_in_window)
     {
-      if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
-        {
-          return;
-        }
+      read_ahead->hits++;
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_HITS);
 
-      if (m_first_run)
+      if (window_end - vpid->pageid > window_npages / 2)
 	{
-	  gettimeofday (&m_end, NULL);
-	  m_first_run = false;
+	  /* scan is still far from the end of requested window */
 	  return;
 	}
-
-      struct timeval begin, diff;
-      int token_gen, token_consumed;
-
-      gettimeofday (&begin, NULL);
-      perfmon_diff_timeval (&diff, &m_end, &begin);
-
-      int64_t diff_usec = diff.tv_sec * 1000000LL + diff.tv_usec;
-      fileio_flush_control_add_tokens (&thread_ref, diff_usec, &token_gen, &token_consumed);
-
-      gettimeofday (&m_end, NULL);
+      /* request next window while the scan consumes the second half of current window */
+      VPID_SET (&next_window_vpid, vpid->volid, window_end);
+    }
+  else
+    {
+      if (read_ahead->seq_count > PGBUF_READ_AHEAD_MIN_SEQUENTIAL)
+	{
+	  /* sequential scan got to a page that was not requested ahead */
+	  read_ahead->misses++;
+	  perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_MISSES);
+	}
+      VPID_SET (&next_window_vpid, vpid->volid, vpid->pageid + 1);
     }
 
-    void retire (void) override
+  if (pgbuf_read_ahead_request (thread_p, &next_window_vpid, window_npages))
     {
-      fileio_flush_control_finalize ();
-      delete this;
+      read_ahead->window_vpid = next_window_vpid;
+      read_ahead->window_npages = window_npages;
     }
-};
-#endif /* SERVER_MODE */
+}
 
-#if defined (SERVER_MODE)
 /*
- * pgbuf_page_maintenance_daemon_init () - initialize page maintenance daemon thread
+ * pgbuf_is_read_ahead_allowed () - can pages be read ahead now?
+ *
+ * return : true if read-ahead is allowed, false otherwise
+ *
+ * note: nobody asked for read-ahead pages yet, so they must not compete with page fixers for victims. read-ahead
+ *       proceeds only while there are invalid bcb's or while the buffer is rich in victims.
  */
-void
-pgbuf_page_maintenance_daemon_init ()
+static bool
+pgbuf_is_read_ahead_allowed (void)
 {
-  assert (pgbuf_Page_maintenance_daemon == NULL);
-
-  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
-  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_page_maintenance_execute);
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      /* not during recovery */
+      return false;
+    }
 
-  pgbuf_Page_maintenance_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
-                                                                            "pgbuf_page_maintenance");
+  return pgbuf_Pool.buf_invalid_list.invalid_cnt > 0 || pgbuf_Pool.monitor.victim_rich;
 }
-#endif /* SERVER_MODE */
 
-#if defined (SERVER_MODE)
 /*
- * pgbuf_page_flush_daemon_init () - initialize page flush daemon thread
+ * pgbuf_read_ahead_request () - request a window of pages to be read ahead
+ *
+ * return        : true if request was accepted, false if it was dropped
+ * thread_p (in) : thread entry
+ * vpid (in)     : first page of window
+ * npages (in)   : number of pages in window
  */
-void
-pgbuf_page_flush_daemon_init ()
+static bool
+pgbuf_read_ahead_request (THREAD_ENTRY * thread_p, const VPID * vpid, int npages)
 {
-  assert (pgbuf_Page_flush_daemon == NULL);
+  PGBUF_READ_AHEAD_REQUEST request;
 
-  cubthread::looper looper = cubthread::looper (pgbuf_get_page_flush_interval);
-  pgbuf_page_flush_daemon_task *daemon_task = new pgbuf_page_flush_daemon_task ();
+  if (!pgbuf_is_read_ahead_allowed ())
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_DROPPED);
+      return false;
+    }
 
-  pgbuf_Page_flush_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "pgbuf_page_flush");
-}
-#endif /* SERVER_MODE */
+  request.vpid = *vpid;
+  request.npages = npages;
 
 #if defined (SERVER_MODE)
+  if (pgbuf_Read_ahead_daemon == NULL || !pgbuf_Pool.read_ahead_requests->produce (request))
+    {
+      /* daemon is not running or it is too far behind */
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_DROPPED);
+      return false;
+    }
+  perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_REQUESTS);
+  pgbuf_Read_ahead_daemon->wakeup ();
+#else /* !SERVER_MODE */
+  /* there is no daemon to load the pages asynchronously. load them now; contiguous pages are still read with a single
+   * I/O. keep the error context of caller. */
+  perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_REQUESTS);
+  er_stack_push ();
+  (void) pgbuf_read_ahead_execute (thread_p, &request);
+  er_stack_pop ();
+#endif /* !SERVER_MODE */
+
+  return true;
+}
+
 /*
- * pgbuf_page_post_flush_daemon_init () - initialize page post flush daemon thread
- */
+ * pgbuf_read_ahead_execute () - load the pages of a read-ahead window in page buffer
+ *
+ * return        : number of pages loaded
+ * thread_p (in) : thread entry
+ * request (in)  : read-ahead request
+ *
+ * note: pages already in buffer (or being loaded by other threads) are skipped. each run of contiguous missing pages
+ *       is read from disk with one I/O.
+ */
+static int
+pgbuf_read_ahead_execute (THREAD_ENTRY * thread_p, const PGBUF_READ_AHEAD_REQUEST * request)
+{
+  PGBUF_BCB *run_bcbs[PGBUF_READ_AHEAD_MAX_PAGES];
+  VPID vpid;
+  int vol_fd;
+  int npages;
+  int run_start, run_npages;
+  int i;
+  int nloaded = 0;
+  bool is_read;
+
+  assert (request != NULL && request->npages > 0);
+
+  vol_fd = fileio_get_volume_descriptor (request->vpid.volid);
+  if (vol_fd == NULL_VOLDES)
+    {
+      return 0;
+    }
+
+  npages = MIN (request->npages, PGBUF_READ_AHEAD_MAX_PAGES);
+  npages = pgbuf_read_ahead_trim_to_reserved (thread_p, &request->vpid, npages);
+
+  vpid.volid = request->vpid.volid;
+  run_start = 0;
+  while (run_start < npages)
+    {
+      /* claim bcb's for a run of contiguous pages that are not in buffer */
+      run_npages = 0;
+      while (run_start + run_npages < npages && pgbuf_is_read_ahead_allowed ())
+	{
+	  vpid.pageid = request->vpid.pageid + run_start + run_npages;
+	  run_bcbs[run_npages] = pgbuf_read_ahead_claim_bcb (thread_p, &vpid, run_npages);
+	  if (run_bcbs[run_npages] == NULL)
+	    {
+	      break;
+	    }
+	  run_npages++;
+	}
+
+      if (run_npages > 0)
+	{
+	  is_read = fileio_read_pages (thread_p, vol_fd, pgbuf_Pool.read_ahead_io_area,
+				       request->vpid.pageid + run_start, run_npages, IO_PAGESIZE) != NULL;
+	  if (!is_read)
+	    {
+	      er_clear ();
+	    }
+	  perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_IOREADS);
+
+	  for (i = 0; i < run_npages; i++)
+	    {
+	      if (pgbuf_read_ahead_load_bcb (thread_p, run_bcbs[i],
+					     is_read ? pgbuf_Pool.read_ahead_io_area + (size_t) i * IO_PAGESIZE : NULL))
+		{
+		  nloaded++;
+		}
+	    }
+	}
+      else if (!pgbuf_is_read_ahead_allowed ())
+	{
+	  /* buffer is short of victims; drop the rest of window */
+	  break;
+	}
+
+      /* skip the page that ended the run */
+      run_start += run_npages + 1;
+    }
+
+  return nloaded;
+}
+
+/*
+ * pgbuf_read_ahead_trim_to_reserved () - trim read-ahead window to its reserved sectors. pages of unreserved sectors
+ *                                        may be beyond the end of volume file and are of no use anyway.
+ *
+ * return        : number of pages in trimmed window
+ * thread_p (in) : thread entry
+ * vpid (in)     : first page of window
+ * npages (in)   : number of pages in window
+ */
+static int
+pgbuf_read_ahead_trim_to_reserved (THREAD_ENTRY * thread_p, const VPID * vpid, int npages)
+{
+  PAGEID pageid = vpid->pageid;
+  PAGEID end_pageid = vpid->pageid + npages;
+  DISK_ISVALID isvalid;
+
+  /* check first page of window and then first page of each following sector */
+  while (pageid < end_pageid)
+    {
+      isvalid = disk_is_page_sector_reserved (thread_p, vpid->volid, pageid);
+      if (isvalid != DISK_VALID)
+	{
+	  if (isvalid == DISK_ERROR)
+	    {
+	      er_clear ();
+	    }
+	  break;
+	}
+      pageid = SECTOR_FIRST_PAGEID (SECTOR_FROM_PAGEID (pageid) + 1);
+    }
+
+  return (int) (MIN (pageid, end_pageid) - vpid->pageid);
+}
+
+/*
+ * pgbuf_read_ahead_claim_bcb () - claim a bcb to read ahead a page that is not in buffer
+ *
+ * return          : bcb with mutex held, or NULL if page is already in buffer or cannot be claimed now
+ * thread_p (in)   : thread entry
+ * vpid (in)       : page identifier
+ * run_index (in)  : index of page in current run of contiguous pages
+ *
+ * note: like pgbuf_claim_bcb_for_fix (), the page is buffer-locked until it is loaded. unlike it, read-ahead never
+ *       waits for a page being loaded by another thread, and it may keep a whole run of pages buffer-locked.
+ */
+static PGBUF_BCB *
+pgbuf_read_ahead_claim_bcb (THREAD_ENTRY * thread_p, const VPID * vpid, int run_index)
+{
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+#if defined (SERVER_MODE)
+  PGBUF_BUFFER_LOCK *buffer_lock;
+#endif /* SERVER_MODE */
+
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
+  if (bufptr != NULL)
+    {
+      /* already in buffer */
+      PGBUF_BCB_UNLOCK (bufptr);
+      return NULL;
+    }
+
+  /* the caller is holding hash_anchor->hash_mutex */
+  if (er_errid () == ER_CSS_PTHREAD_MUTEX_TRYLOCK)
+    {
+      pthread_mutex_unlock (&hash_anchor->hash_mutex);
+      er_clear ();
+      return NULL;
+    }
+
+#if defined (SERVER_MODE)
+  for (buffer_lock = hash_anchor->lock_next; buffer_lock != NULL; buffer_lock = buffer_lock->lock_next)
+    {
+      if (VPID_EQ (&buffer_lock->vpid, vpid))
+	{
+	  /* another thread is loading the page */
+	  pthread_mutex_unlock (&hash_anchor->hash_mutex);
+	  return NULL;
+	}
+    }
+
+  /* buffer-lock the page using the entry reserved for this run index */
+  buffer_lock = PGBUF_READ_AHEAD_BUFFER_LOCK (run_index);
+  assert (buffer_lock->lock_next == NULL && buffer_lock->next_wait_thrd == NULL);
+  buffer_lock->vpid = *vpid;
+  buffer_lock->next_wait_thrd = NULL;
+  buffer_lock->lock_next = hash_anchor->lock_next;
+  hash_anchor->lock_next = buffer_lock;
+#endif /* SERVER_MODE */
+  pthread_mutex_unlock (&hash_anchor->hash_mutex);
+
+  bufptr = pgbuf_allocate_bcb (thread_p, vpid);
+  if (bufptr == NULL)
+    {
+      er_clear ();
+      (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
+      return NULL;
+    }
+
+  /* initialize the BCB */
+  bufptr->vpid = *vpid;
+  assert (!pgbuf_bcb_avoid_victim (bufptr));
+  bufptr->latch_mode = PGBUF_NO_LATCH;
+  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_ASYNC_FLUSH_REQ);
+  pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
+  LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+
+  return bufptr;
+}
+
+/*
+ * pgbuf_read_ahead_load_bcb () - finish loading a read-ahead page and make it available to fixers
+ *
+ * return        : true if page was loaded, false if it was dropped
+ * thread_p (in) : thread entry
+ * bufptr (in)   : bcb claimed by pgbuf_read_ahead_claim_bcb ()
+ * io_page (in)  : page image read from disk or NULL if read failed
+ */
+static bool
+pgbuf_read_ahead_load_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, const char *io_page)
+{
+  PGBUF_BUFFER_HASH *hash_anchor;
+  FILEIO_PAGE *iopage = &bufptr->iopage_buffer->iopage;
+  PAGE_PTR pgptr;
+  TDE_ALGORITHM tde_algo;
+  VPID vpid = bufptr->vpid;
+  bool is_valid = false;
+  bool success = false;
+  bool is_compressed_cache_hit = false;
+
+  /* the caller is holding bufptr->mutex and the page is buffer-locked */
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&vpid)];
+
+  if (io_page != NULL && pgbuf_compressed_cache_load (thread_p, &vpid, iopage))
+    {
+      /* decompressed image is already decrypted */
+      is_valid = true;
+      is_compressed_cache_hit = true;
+    }
+  else if (io_page != NULL)
+    {
+      /* the most recent image of page may be in double write buffer */
+      if (dwb_read_page (thread_p, &vpid, iopage, &success) != NO_ERROR)
+	{
+	  er_clear ();
+	}
+      else
+	{
+	  if (!success)
+	    {
+	      memcpy (iopage, io_page, IO_PAGESIZE);
+	    }
+
+	  /* skip pages that were never written */
+	  is_valid = (iopage->prv.volid == vpid.volid && iopage->prv.pageid == vpid.pageid);
+	  if (is_valid && pgbuf_is_temporary_volume (vpid.volid) && !pgbuf_is_temp_lsa (iopage->prv.lsa))
+	    {
+	      is_valid = false;
+	    }
+	}
+    }
+
+  if (is_valid && !is_compressed_cache_hit)
+    {
+      CAST_IOPGPTR_TO_PGPTR (pgptr, iopage);
+      tde_algo = pgbuf_get_tde_algorithm (pgptr);
+      if (tde_algo != TDE_ALGORITHM_NONE
+	  && tde_decrypt_data_page (iopage, tde_algo, pgbuf_is_temporary_volume (vpid.volid), iopage) != NO_ERROR)
+	{
+	  er_clear ();
+	  is_valid = false;
+	}
+    }
+
+  if (!is_valid)
+    {
+      /* bufptr->mutex will be released in following function. */
+      pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+      (void) pgbuf_unlock_page (thread_p, hash_anchor, &vpid, true);
+      return false;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_PAGES);
+
+  /* hash_anchor->hash_mutex is released in pgbuf_unlock_page () */
+  pgbuf_insert_into_hash_chain (thread_p, hash_anchor, bufptr);
+  (void) pgbuf_unlock_page (thread_p, hash_anchor, &vpid, false);
+
+  /* page was not accessed yet. add it to the middle of a shared list, like any new page, so a page that is never used
+   * is victimized before hot pages. */
+  pgbuf_lru_add_new_bcb_to_middle (thread_p, bufptr, pgbuf_get_shared_lru_index_for_add (bufptr));
+  PGBUF_BCB_UNLOCK (bufptr);
+
+  return true;
+}
+
+/*
+ * pgbuf_initialize_bulk_read_rings () - allocate the bulk read rings of all threads
+ *
+ * return : error code
+ */
+static int
+pgbuf_initialize_bulk_read_rings (void)
+{
+  int nrings;
+  int ring_npages;
+  int i;
+  size_t size;
+
+  pgbuf_Pool.bulk_read_rings = NULL;
+  pgbuf_Pool.bulk_read_ring_npages = 0;
+
+  ring_npages = prm_get_integer_value (PRM_ID_PB_BULK_READ_RING_PAGES);
+  if (ring_npages <= 0)
+    {
+      /* disabled */
+      return NO_ERROR;
+    }
+  /* a ring should never take a significant part of buffer */
+  ring_npages = MIN (ring_npages, pgbuf_Pool.num_buffers / 64);
+  if (ring_npages <= 0)
+    {
+      return NO_ERROR;
+    }
+
+#if defined (SERVER_MODE)
+  nrings = (int) thread_num_total_threads ();
+#else /* !SERVER_MODE */
+  nrings = 1;
+#endif /* !SERVER_MODE */
+
+  size = (size_t) nrings * sizeof (PGBUF_BULK_READ_RING);
+  pgbuf_Pool.bulk_read_rings = (PGBUF_BULK_READ_RING *) malloc (size);
+  if (pgbuf_Pool.bulk_read_rings == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (pgbuf_Pool.bulk_read_rings, 0, size);
+
+  /* slots of all rings are allocated at once */
+  size = (size_t) nrings * ring_npages * sizeof (PGBUF_BCB *);
+  pgbuf_Pool.bulk_read_rings[0].bcbs = (PGBUF_BCB **) malloc (size);
+  if (pgbuf_Pool.bulk_read_rings[0].bcbs == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      free_and_init (pgbuf_Pool.bulk_read_rings);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (pgbuf_Pool.bulk_read_rings[0].bcbs, 0, size);
+
+  size = (size_t) nrings * ring_npages * sizeof (VPID);
+  pgbuf_Pool.bulk_read_rings[0].vpids = (VPID *) malloc (size);
+  if (pgbuf_Pool.bulk_read_rings[0].vpids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      free_and_init (pgbuf_Pool.bulk_read_rings[0].bcbs);
+      free_and_init (pgbuf_Pool.bulk_read_rings);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < nrings; i++)
+    {
+      pgbuf_Pool.bulk_read_rings[i].bcbs = pgbuf_Pool.bulk_read_rings[0].bcbs + (size_t) i * ring_npages;
+      pgbuf_Pool.bulk_read_rings[i].vpids = pgbuf_Pool.bulk_read_rings[0].vpids + (size_t) i * ring_npages;
+      pgbuf_Pool.bulk_read_rings[i].cursor = 0;
+      pgbuf_Pool.bulk_read_rings[i].nesting = 0;
+    }
+  for (i = 0; i < nrings * ring_npages; i++)
+    {
+      VPID_SET_NULL (&pgbuf_Pool.bulk_read_rings[0].vpids[i]);
+    }
+
+  pgbuf_Pool.bulk_read_ring_npages = ring_npages;
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_finalize_bulk_read_rings () - free the bulk read rings
+ *
+ * return : void
+ */
+static void
+pgbuf_finalize_bulk_read_rings (void)
+{
+  if (pgbuf_Pool.bulk_read_rings != NULL)
+    {
+      if (pgbuf_Pool.bulk_read_rings[0].bcbs != NULL)
+	{
+	  free_and_init (pgbuf_Pool.bulk_read_rings[0].bcbs);
+	}
+      if (pgbuf_Pool.bulk_read_rings[0].vpids != NULL)
+	{
+	  free_and_init (pgbuf_Pool.bulk_read_rings[0].vpids);
+	}
+      free_and_init (pgbuf_Pool.bulk_read_rings);
+    }
+  pgbuf_Pool.bulk_read_ring_npages = 0;
+}
+
+/*
+ * pgbuf_get_bulk_read_ring () - get the bulk read ring of thread if it is inside a bulk read scope
+ *
+ * return        : bulk read ring or NULL
+ * thread_p (in) : thread entry
+ */
+STATIC_INLINE PGBUF_BULK_READ_RING *
+pgbuf_get_bulk_read_ring (THREAD_ENTRY * thread_p)
+{
+  PGBUF_BULK_READ_RING *ring;
+
+  if (pgbuf_Pool.bulk_read_rings == NULL)
+    {
+      return NULL;
+    }
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  assert (thread_p->index >= 0 && thread_p->index < (int) thread_num_total_threads ());
+  ring = &pgbuf_Pool.bulk_read_rings[thread_p->index];
+#else /* !SERVER_MODE */
+  ring = &pgbuf_Pool.bulk_read_rings[0];
+#endif /* !SERVER_MODE */
+
+  return ring->nesting > 0 ? ring : NULL;
+}
+
+/*
+ * pgbuf_bulk_read_ring_get_victim () - reuse the oldest buffer of bulk read ring for next page of scan
+ *
+ * return        : victimized bcb (with its mutex held) or NULL if the buffer cannot be reused
+ * thread_p (in) : thread entry
+ * ring (in)     : bulk read ring of thread
+ *
+ * note: the buffer is reused only if it still holds the page the scan loaded, nobody else fixed it since (it is still
+ *       in the victim zone, where it was added on unfix) and it is not dirty. dirty buffers (e.g. first access of
+ *       temporary pages) are left for the flush thread, no inline flush is done here.
+ */
+static PGBUF_BCB *
+pgbuf_bulk_read_ring_get_victim (THREAD_ENTRY * thread_p, PGBUF_BULK_READ_RING * ring)
+{
+  PGBUF_BCB *bufptr;
+  int slot = ring->cursor;
+
+  bufptr = ring->bcbs[slot];
+  if (bufptr == NULL)
+    {
+      /* ring is not full yet */
+      return NULL;
+    }
+
+  if (PGBUF_BCB_TRYLOCK (bufptr) != 0)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_BULK_READ_RING_SKIPS);
+      return NULL;
+    }
+
+  if (!VPID_EQ (&bufptr->vpid, &ring->vpids[slot]) || !PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (bufptr)
+      || !pgbuf_is_bcb_victimizable (bufptr, true))
+    {
+      PGBUF_BCB_UNLOCK (bufptr);
+      perfmon_inc_stat (thread_p, PSTAT_PB_BULK_READ_RING_SKIPS);
+      return NULL;
+    }
+
+  pgbuf_lru_remove_bcb (thread_p, bufptr);
+  if (pgbuf_victimize_bcb (thread_p, bufptr) != NO_ERROR)
+    {
+      /* bufptr->mutex was released */
+      assert (false);
+      return NULL;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_BULK_READ_RING_REUSES);
+  return bufptr;
+}
+
+/*
+ * pgbuf_bulk_read_ring_admit () - admit a page loaded by a large sequential scan through its bulk read ring
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * ring (in)     : bulk read ring of thread
+ * bufptr (in)   : bcb of loaded page (its mutex is held)
+ *
+ * note: the page goes to the bottom of lru on unfix, instead of the hot zone, so the scan cannot flush the working set
+ *       of other transactions out of buffer.
+ */
+static void
+pgbuf_bulk_read_ring_admit (THREAD_ENTRY * thread_p, PGBUF_BULK_READ_RING * ring, PGBUF_BCB * bufptr)
+{
+  ring->bcbs[ring->cursor] = bufptr;
+  ring->vpids[ring->cursor] = bufptr->vpid;
+  ring->cursor = (ring->cursor + 1) % pgbuf_Pool.bulk_read_ring_npages;
+
+  pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG, 0);
+  perfmon_inc_stat (thread_p, PSTAT_PB_BULK_READ_RING_ADMISSIONS);
+}
+
+/*
+ * pgbuf_bulk_read_begin () - start a bulk read scope. pages loaded in buffer by thread inside the scope are admitted
+ *                            through its bulk read ring.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+void
+pgbuf_bulk_read_begin (THREAD_ENTRY * thread_p)
+{
+  if (pgbuf_Pool.bulk_read_rings == NULL)
+    {
+      return;
+    }
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  pgbuf_Pool.bulk_read_rings[thread_p->index].nesting++;
+#else /* !SERVER_MODE */
+  pgbuf_Pool.bulk_read_rings[0].nesting++;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * pgbuf_bulk_read_end () - end a bulk read scope
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+void
+pgbuf_bulk_read_end (THREAD_ENTRY * thread_p)
+{
+  PGBUF_BULK_READ_RING *ring;
+
+  ring = pgbuf_get_bulk_read_ring (thread_p);
+  if (ring == NULL)
+    {
+      return;
+    }
+
+  assert (ring->nesting > 0);
+  ring->nesting--;
+}
+
+/*
+ * pgbuf_is_bulk_read_scan () - is the scan large enough to be admitted through bulk read ring?
+ *
+ * return          : true if scan read sequentially more pages than the ring and a sixteenth of buffer
+ * read_ahead (in) : read-ahead state of scan
+ */
+bool
+pgbuf_is_bulk_read_scan (const PGBUF_READ_AHEAD * read_ahead)
+{
+  if (pgbuf_Pool.bulk_read_rings == NULL)
+    {
+      return false;
+    }
+
+  return read_ahead->seq_count >= PGBUF_BULK_READ_MIN_SEQUENTIAL (pgbuf_Pool.bulk_read_ring_npages);
+}
+
+/*
+ * pgbuf_initialize_compressed_cache () - initialize compressed cache of evicted pages
+ *
+ * return : error code
+ */
+static int
+pgbuf_initialize_compressed_cache (void)
+{
+  PGBUF_COMPRESSED_CACHE *cache = &pgbuf_Pool.compressed_cache;
+  INT64 max_size;
+  INT64 num_buckets;
+  int i;
+
+  memset (cache, 0, sizeof (*cache));
+
+  max_size = (INT64) prm_get_bigint_value (PRM_ID_PB_COMPRESSED_CACHE_SIZE);
+  if (max_size < IO_PAGESIZE)
+    {
+      /* disabled */
+      return NO_ERROR;
+    }
+
+  /* one bucket for each page compressed to half its size */
+  num_buckets = max_size / (IO_PAGESIZE / 2);
+  num_buckets = MIN (num_buckets, INT_MAX / (int) sizeof (PGBUF_COMPRESSED_CACHE_BUCKET));
+
+  cache->buckets =
+    (PGBUF_COMPRESSED_CACHE_BUCKET *) malloc ((size_t) num_buckets * sizeof (PGBUF_COMPRESSED_CACHE_BUCKET));
+  if (cache->buckets == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) num_buckets * sizeof (PGBUF_COMPRESSED_CACHE_BUCKET));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  for (i = 0; i < num_buckets; i++)
+    {
+      pthread_mutex_init (&cache->buckets[i].mutex, NULL);
+      cache->buckets[i].head = NULL;
+    }
+  pthread_mutex_init (&cache->fifo_mutex, NULL);
+
+  cache->num_buckets = (int) num_buckets;
+  cache->max_size = max_size;
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_finalize_compressed_cache () - free compressed cache of evicted pages
+ *
+ * return : void
+ */
+static void
+pgbuf_finalize_compressed_cache (void)
+{
+  PGBUF_COMPRESSED_CACHE *cache = &pgbuf_Pool.compressed_cache;
+  int i;
+
+  if (cache->buckets == NULL)
+    {
+      return;
+    }
+
+  pgbuf_compressed_cache_remove_volume (NULL_VOLID);
+  assert (cache->size == 0 && cache->fifo_head == NULL);
+
+  for (i = 0; i < cache->num_buckets; i++)
+    {
+      pthread_mutex_destroy (&cache->buckets[i].mutex);
+    }
+  pthread_mutex_destroy (&cache->fifo_mutex);
+
+  free_and_init (cache->buckets);
+  cache->num_buckets = 0;
+  cache->max_size = 0;
+}
+
+/*
+ * pgbuf_compressed_cache_get_bucket () - get bucket of page in compressed cache
+ *
+ * return    : bucket
+ * vpid (in) : page identifier
+ */
+STATIC_INLINE PGBUF_COMPRESSED_CACHE_BUCKET *
+pgbuf_compressed_cache_get_bucket (const VPID * vpid)
+{
+  unsigned int hash = ((unsigned int) vpid->volid << 24) ^ (unsigned int) vpid->pageid;
+
+  return &pgbuf_Pool.compressed_cache.buckets[hash % pgbuf_Pool.compressed_cache.num_buckets];
+}
+
+/*
+ * pgbuf_compressed_cache_unlink () - remove page from its bucket and from eviction list
+ *
+ * return      : void
+ * bucket (in) : bucket of page
+ * cpage (in)  : cached page
+ *
+ * note: caller must hold bucket mutex. the caller becomes the owner of the page and has to free it.
+ */
+static void
+pgbuf_compressed_cache_unlink (PGBUF_COMPRESSED_CACHE_BUCKET * bucket, PGBUF_COMPRESSED_PAGE * cpage)
+{
+  PGBUF_COMPRESSED_CACHE *cache = &pgbuf_Pool.compressed_cache;
+  PGBUF_COMPRESSED_PAGE **prev_link;
+
+  for (prev_link = &bucket->head; *prev_link != cpage; prev_link = &(*prev_link)->hash_next)
+    {
+      assert (*prev_link != NULL);
+    }
+  *prev_link = cpage->hash_next;
+  cpage->hash_next = NULL;
+
+  pthread_mutex_lock (&cache->fifo_mutex);
+  if (cpage->in_fifo)
+    {
+      if (cpage->fifo_prev != NULL)
+	{
+	  cpage->fifo_prev->fifo_next = cpage->fifo_next;
+	}
+      else
+	{
+	  cache->fifo_head = cpage->fifo_next;
+	}
+      if (cpage->fifo_next != NULL)
+	{
+	  cpage->fifo_next->fifo_prev = cpage->fifo_prev;
+	}
+      else
+	{
+	  cache->fifo_tail = cpage->fifo_prev;
+	}
+      cpage->fifo_prev = cpage->fifo_next = NULL;
+      cpage->in_fifo = false;
+    }
+  pthread_mutex_unlock (&cache->fifo_mutex);
+}
+
+/*
+ * pgbuf_compressed_cache_free_page () - free a page removed from compressed cache
+ *
+ * return     : void
+ * cpage (in) : cached page
+ */
+static void
+pgbuf_compressed_cache_free_page (PGBUF_COMPRESSED_PAGE * cpage)
+{
+  (void) ATOMIC_INC_64 (&pgbuf_Pool.compressed_cache.size, -cpage->alloc_size);
+  free (cpage);
+}
+
+/*
+ * pgbuf_compressed_cache_store () - store compressed image of a clean page that is evicted from buffer
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * bufptr (in)   : victim bcb, still in hash chain
+ *
+ * note: the caller is holding bufptr->mutex. temporary pages and pages that do not compress well are not stored.
+ */
+static void
+pgbuf_compressed_cache_store (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
+{
+  PGBUF_COMPRESSED_CACHE *cache = &pgbuf_Pool.compressed_cache;
+  PGBUF_COMPRESSED_CACHE_BUCKET *bucket;
+  PGBUF_COMPRESSED_PAGE *cpage, *old_cpage;
+  FILEIO_PAGE *iopage = &bufptr->iopage_buffer->iopage;
+  char compress_buf[LZ4_COMPRESSBOUND (IO_MAX_PAGE_SIZE)];
+  int data_size;
+  int alloc_size;
+
+  if (cache->num_buckets == 0)
+    {
+      return;
+    }
+
+  /* only valid images of permanent pages; victims are never dirty */
+  if (VPID_ISNULL (&bufptr->vpid) || pgbuf_bcb_get_zone (bufptr) == PGBUF_INVALID_ZONE
+      || iopage->prv.volid != bufptr->vpid.volid || iopage->prv.pageid != bufptr->vpid.pageid
+      || pgbuf_is_temporary_volume (bufptr->vpid.volid))
+    {
+      return;
+    }
+  assert (!pgbuf_bcb_is_dirty (bufptr));
+
+  data_size = LZ4_compress_default ((const char *) iopage, compress_buf, IO_PAGESIZE, (int) sizeof (compress_buf));
+  if (data_size <= 0 || data_size > IO_PAGESIZE - IO_PAGESIZE / 4)
+    {
+      /* not worth the memory */
+      perfmon_inc_stat (thread_p, PSTAT_PB_COMPRESSED_CACHE_SKIPS);
+      return;
+    }
+
+  alloc_size = (int) offsetof (PGBUF_COMPRESSED_PAGE, data) + data_size;
+  cpage = (PGBUF_COMPRESSED_PAGE *) malloc (alloc_size);
+  if (cpage == NULL)
+    {
+      /* not critical */
+      return;
+    }
+  cpage->vpid = bufptr->vpid;
+  cpage->alloc_size = alloc_size;
+  cpage->data_size = data_size;
+  cpage->hash_next = NULL;
+  memcpy (cpage->data, compress_buf, data_size);
+  (void) ATOMIC_INC_64 (&cache->size, alloc_size);
+
+  bucket = pgbuf_compressed_cache_get_bucket (&cpage->vpid);
+  pthread_mutex_lock (&bucket->mutex);
+
+  /* a page is cached only while it is out of buffer; an older image cannot exist, but be safe */
+  for (old_cpage = bucket->head; old_cpage != NULL; old_cpage = old_cpage->hash_next)
+    {
+      if (VPID_EQ (&old_cpage->vpid, &cpage->vpid))
+	{
+	  break;
+	}
+    }
+  if (old_cpage != NULL)
+    {
+      assert (false);
+      pgbuf_compressed_cache_unlink (bucket, old_cpage);
+      pgbuf_compressed_cache_free_page (old_cpage);
+    }
+
+  cpage->hash_next = bucket->head;
+  bucket->head = cpage;
+
+  pthread_mutex_lock (&cache->fifo_mutex);
+  cpage->fifo_prev = NULL;
+  cpage->fifo_next = cache->fifo_head;
+  if (cache->fifo_head != NULL)
+    {
+      cache->fifo_head->fifo_prev = cpage;
+    }
+  else
+    {
+      cache->fifo_tail = cpage;
+    }
+  cache->fifo_head = cpage;
+  cpage->in_fifo = true;
+  pthread_mutex_unlock (&cache->fifo_mutex);
+
+  pthread_mutex_unlock (&bucket->mutex);
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_COMPRESSED_CACHE_STORES);
+  perfmon_add_stat (thread_p, PSTAT_PB_COMPRESSED_CACHE_PAGE_BYTES, IO_PAGESIZE);
+  perfmon_add_stat (thread_p, PSTAT_PB_COMPRESSED_CACHE_STORED_BYTES, data_size);
+
+  if (cache->size > cache->max_size)
+    {
+      pgbuf_compressed_cache_evict (thread_p);
+    }
+}
+
+/*
+ * pgbuf_compressed_cache_load () - load a page from compressed cache
+ *
+ * return        : true if page was found and decompressed
+ * thread_p (in) : thread entry
+ * vpid (in)     : page identifier
+ * iopage (out)  : page image
+ *
+ * note: the caller holds the page buffer lock of vpid. the page leaves compressed cache since it is loaded in buffer.
+ */
+static bool
+pgbuf_compressed_cache_load (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * iopage)
+{
+  PGBUF_COMPRESSED_CACHE_BUCKET *bucket;
+  PGBUF_COMPRESSED_PAGE *cpage;
+  bool found = false;
+
+  if (pgbuf_Pool.compressed_cache.num_buckets == 0)
+    {
+      return false;
+    }
+
+  bucket = pgbuf_compressed_cache_get_bucket (vpid);
+  pthread_mutex_lock (&bucket->mutex);
+  for (cpage = bucket->head; cpage != NULL; cpage = cpage->hash_next)
+    {
+      if (VPID_EQ (&cpage->vpid, vpid))
+	{
+	  pgbuf_compressed_cache_unlink (bucket, cpage);
+	  break;
+	}
+    }
+  pthread_mutex_unlock (&bucket->mutex);
+
+  if (cpage == NULL)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_COMPRESSED_CACHE_MISSES);
+      return false;
+    }
+
+  found = (LZ4_decompress_safe (cpage->data, (char *) iopage, cpage->data_size, IO_PAGESIZE) == IO_PAGESIZE);
+  assert (found);
+  pgbuf_compressed_cache_free_page (cpage);
+
+  perfmon_inc_stat (thread_p, found ? PSTAT_PB_COMPRESSED_CACHE_HITS : PSTAT_PB_COMPRESSED_CACHE_MISSES);
+  return found;
+}
+
+/*
+ * pgbuf_compressed_cache_remove () - drop the image of a page from compressed cache
+ *
+ * return    : void
+ * vpid (in) : page identifier
+ */
+static void
+pgbuf_compressed_cache_remove (const VPID * vpid)
+{
+  PGBUF_COMPRESSED_CACHE_BUCKET *bucket;
+  PGBUF_COMPRESSED_PAGE *cpage;
+
+  if (pgbuf_Pool.compressed_cache.num_buckets == 0)
+    {
+      return;
+    }
+
+  bucket = pgbuf_compressed_cache_get_bucket (vpid);
+  pthread_mutex_lock (&bucket->mutex);
+  for (cpage = bucket->head; cpage != NULL; cpage = cpage->hash_next)
+    {
+      if (VPID_EQ (&cpage->vpid, vpid))
+	{
+	  pgbuf_compressed_cache_unlink (bucket, cpage);
+	  break;
+	}
+    }
+  pthread_mutex_unlock (&bucket->mutex);
+
+  if (cpage != NULL)
+    {
+      pgbuf_compressed_cache_free_page (cpage);
+    }
+}
+
+/*
+ * pgbuf_compressed_cache_remove_volume () - drop images of all pages of a volume from compressed cache
+ *
+ * return     : void
+ * volid (in) : volume identifier or NULL_VOLID for all volumes
+ */
+static void
+pgbuf_compressed_cache_remove_volume (VOLID volid)
+{
+  PGBUF_COMPRESSED_CACHE *cache = &pgbuf_Pool.compressed_cache;
+  PGBUF_COMPRESSED_CACHE_BUCKET *bucket;
+  PGBUF_COMPRESSED_PAGE *cpage, *next_cpage;
+  int i;
+
+  for (i = 0; i < cache->num_buckets; i++)
+    {
+      bucket = &cache->buckets[i];
+      if (bucket->head == NULL)
+	{
+	  continue;
+	}
+
+      pthread_mutex_lock (&bucket->mutex);
+      for (cpage = bucket->head; cpage != NULL; cpage = next_cpage)
+	{
+	  next_cpage = cpage->hash_next;
+	  if (volid == NULL_VOLID || cpage->vpid.volid == volid)
+	    {
+	      pgbuf_compressed_cache_unlink (bucket, cpage);
+	      pgbuf_compressed_cache_free_page (cpage);
+	    }
+	}
+      pthread_mutex_unlock (&bucket->mutex);
+    }
+}
+
+/*
+ * pgbuf_compressed_cache_evict () - evict oldest pages until compressed cache fits its memory limit
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+static void
+pgbuf_compressed_cache_evict (THREAD_ENTRY * thread_p)
+{
+  PGBUF_COMPRESSED_CACHE *cache = &pgbuf_Pool.compressed_cache;
+  PGBUF_COMPRESSED_CACHE_BUCKET *bucket;
+  PGBUF_COMPRESSED_PAGE *cpage;
+  VPID vpid;
+
+  while (cache->size > cache->max_size)
+    {
+      /* peek oldest page. bucket mutex must be acquired before eviction list mutex, so the page is looked up again in
+       * its bucket; it may be gone in the meantime. */
+      pthread_mutex_lock (&cache->fifo_mutex);
+      if (cache->fifo_tail == NULL)
+	{
+	  pthread_mutex_unlock (&cache->fifo_mutex);
+	  return;
+	}
+      vpid = cache->fifo_tail->vpid;
+      pthread_mutex_unlock (&cache->fifo_mutex);
+
+      bucket = pgbuf_compressed_cache_get_bucket (&vpid);
+      pthread_mutex_lock (&bucket->mutex);
+      for (cpage = bucket->head; cpage != NULL; cpage = cpage->hash_next)
+	{
+	  if (VPID_EQ (&cpage->vpid, &vpid))
+	    {
+	      pgbuf_compressed_cache_unlink (bucket, cpage);
+	      break;
+	    }
+	}
+      pthread_mutex_unlock (&bucket->mutex);
+
+      if (cpage != NULL)
+	{
+	  pgbuf_compressed_cache_free_page (cpage);
+	  perfmon_inc_stat (thread_p, PSTAT_PB_COMPRESSED_CACHE_EVICTIONS);
+	}
+    }
+}
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_warmup_compare_vpid () - compare pages of warm-up file by volume and page id
+ *
+ * return : negative if a is before b, positive if a is after b, 0 if equal
+ * a (in) : first page id
+ * b (in) : second page id
+ */
+static int
+pgbuf_warmup_compare_vpid (const void *a, const void *b)
+{
+  const VPID *vpid1 = (const VPID *) a;
+  const VPID *vpid2 = (const VPID *) b;
+
+  if (vpid1->volid != vpid2->volid)
+    {
+      return vpid1->volid < vpid2->volid ? -1 : 1;
+    }
+  if (vpid1->pageid != vpid2->pageid)
+    {
+      return vpid1->pageid < vpid2->pageid ? -1 : 1;
+    }
+  return 0;
+}
+
+/*
+ * pgbuf_warmup_dump () - save the pages of hot buffers in warm-up file, so they can be reloaded on next server start
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ *
+ * note: pages in lru zone 1 and pages in lru zone 2 that were fixed more than once are saved. buffers are inspected
+ *       without locking them; the saved pages are only a hint for warm-up.
+ */
+void
+pgbuf_warmup_dump (THREAD_ENTRY * thread_p)
+{
+  char warmup_name[PATH_MAX];
+  char warmup_tmp_name[PATH_MAX];
+  PGBUF_WARMUP_FILE_HEADER header;
+  PGBUF_BCB *bufptr;
+  PGBUF_ZONE zone;
+  VPID *vpids = NULL;
+  VPID vpid;
+  int npages = 0;
+  int bufid;
+  int fix_count;
+  FILE *fp;
+  bool is_written;
+
+  if (!prm_get_bool_value (PRM_ID_PB_WARMUP) || !BO_IS_SERVER_RESTARTED ())
+    {
+      return;
+    }
+
+  if (!pgbuf_Pool.warmup.is_started || pgbuf_Pool.warmup.vpids != NULL)
+    {
+      /* reload did not start or is not finished, and buffer does not reflect the workload yet. keep previous file. */
+      return;
+    }
+  pgbuf_Pool.warmup.last_dump_time = time (NULL);
+
+  vpids = (VPID *) malloc ((size_t) pgbuf_Pool.num_buffers * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) pgbuf_Pool.num_buffers * sizeof (VPID));
+      return;
+    }
+
+  for (bufid = 0; bufid < pgbuf_Pool.num_buffers; bufid++)
+    {
+      bufptr = PGBUF_FIND_BCB_PTR (bufid);
+      vpid = bufptr->vpid;
+      zone = PGBUF_GET_ZONE (bufptr->flags);
+      if (VPID_ISNULL (&vpid) || pgbuf_is_temporary_volume (vpid.volid))
+	{
+	  continue;
+	}
+
+      fix_count = bufptr->count_fix_and_avoid_dealloc >> PGBUF_BCB_COUNT_FIX_SHIFT_BITS;
+      if (zone == PGBUF_LRU_1_ZONE || (zone == PGBUF_LRU_2_ZONE && fix_count >= PGBUF_WARMUP_MIN_FIX_COUNT))
+	{
+	  vpids[npages++] = vpid;
+	}
+    }
+
+  /* pages are reloaded in this order; contiguous pages are read together */
+  qsort (vpids, npages, sizeof (VPID), pgbuf_warmup_compare_vpid);
+
+  header.magic = PGBUF_WARMUP_FILE_MAGIC;
+  header.version = PGBUF_WARMUP_FILE_VERSION;
+  header.page_size = IO_PAGESIZE;
+  header.npages = npages;
+
+  /* write a temporary file and replace the warm-up file with it, so a crash never leaves a partial file */
+  fileio_make_pb_warmup_name (warmup_name, boot_db_full_name ());
+  snprintf (warmup_tmp_name, sizeof (warmup_tmp_name), "%s_t", warmup_name);
+
+  fp = fopen (warmup_tmp_name, "wb");
+  if (fp == NULL)
+    {
+      er_log_debug (ARG_FILE_LINE, "pgbuf_warmup_dump: cannot open %s.\n", warmup_tmp_name);
+      free_and_init (vpids);
+      return;
+    }
+
+  is_written = (fwrite (&header, sizeof (header), 1, fp) == 1
+		&& (npages == 0 || fwrite (vpids, sizeof (VPID), npages, fp) == (size_t) npages));
+  if (fclose (fp) != 0)
+    {
+      is_written = false;
+    }
+
+  if (is_written && os_rename_file (warmup_tmp_name, warmup_name) == 0)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_WARMUP_DUMPS);
+    }
+  else
+    {
+      er_log_debug (ARG_FILE_LINE, "pgbuf_warmup_dump: cannot write %s.\n", warmup_name);
+      (void) remove (warmup_tmp_name);
+    }
+
+  free_and_init (vpids);
+}
+
+/*
+ * pgbuf_warmup_start () - read the pages saved by previous server run, to be reloaded by read-ahead daemon
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+static void
+pgbuf_warmup_start (THREAD_ENTRY * thread_p)
+{
+  char warmup_name[PATH_MAX];
+  PGBUF_WARMUP_FILE_HEADER header;
+  VPID *vpids = NULL;
+  int npages;
+  FILE *fp;
+
+  pgbuf_Pool.warmup.is_started = true;
+  pgbuf_Pool.warmup.last_dump_time = time (NULL);
+
+  if (!prm_get_bool_value (PRM_ID_PB_WARMUP))
+    {
+      return;
+    }
+
+  fileio_make_pb_warmup_name (warmup_name, boot_db_full_name ());
+  fp = fopen (warmup_name, "rb");
+  if (fp == NULL)
+    {
+      /* nothing was saved */
+      return;
+    }
+
+  if (fread (&header, sizeof (header), 1, fp) != 1 || header.magic != PGBUF_WARMUP_FILE_MAGIC
+      || header.version != PGBUF_WARMUP_FILE_VERSION || header.page_size != IO_PAGESIZE || header.npages <= 0)
+    {
+      /* unknown or empty file */
+      fclose (fp);
+      return;
+    }
+
+  /* buffer may have been resized */
+  npages = MIN (header.npages, pgbuf_Pool.num_buffers);
+  vpids = (VPID *) malloc ((size_t) npages * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) npages * sizeof (VPID));
+      fclose (fp);
+      return;
+    }
+
+  if (fread (vpids, sizeof (VPID), npages, fp) != (size_t) npages)
+    {
+      /* truncated file */
+      free_and_init (vpids);
+      fclose (fp);
+      return;
+    }
+  fclose (fp);
+
+  qsort (vpids, npages, sizeof (VPID), pgbuf_warmup_compare_vpid);
+
+  pgbuf_Pool.warmup.npages = npages;
+  pgbuf_Pool.warmup.next = 0;
+  pgbuf_Pool.warmup.loaded = 0;
+  pgbuf_Pool.warmup.vpids = vpids;
+
+  er_log_debug (ARG_FILE_LINE, "pgbuf_warmup_start: %d pages to reload from %s.\n", npages, warmup_name);
+}
+
+/*
+ * pgbuf_warmup_execute () - reload next pages saved for warm-up
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ *
+ * note: pages are read in windows of close pages, like read-ahead windows; contiguous pages are read with one I/O.
+ *       reload stops when buffer has no more free buffers; warm-up never evicts pages that are already used.
+ */
+static void
+pgbuf_warmup_execute (THREAD_ENTRY * thread_p)
+{
+  PGBUF_WARMUP *warmup = &pgbuf_Pool.warmup;
+  PGBUF_READ_AHEAD_REQUEST request;
+  int nwindows = 0;
+  int nloaded;
+  const VPID *vpid;
+
+  if (warmup->vpids == NULL)
+    {
+      return;
+    }
+
+  while (warmup->next < warmup->npages && nwindows < PGBUF_WARMUP_WINDOWS_PER_RUN)
+    {
+      if (pgbuf_Pool.buf_invalid_list.invalid_cnt <= 0)
+	{
+	  /* buffer is full */
+	  break;
+	}
+
+      /* extend window while next pages are close enough to be read together */
+      request.vpid = warmup->vpids[warmup->next++];
+      request.npages = 1;
+      while (warmup->next < warmup->npages)
+	{
+	  vpid = &warmup->vpids[warmup->next];
+	  if (vpid->volid != request.vpid.volid
+	      || vpid->pageid - (request.vpid.pageid + request.npages - 1) > PGBUF_READ_AHEAD_MAX_GAP
+	      || vpid->pageid - request.vpid.pageid >= PGBUF_READ_AHEAD_MAX_PAGES)
+	    {
+	      break;
+	    }
+	  request.npages = vpid->pageid - request.vpid.pageid + 1;
+	  warmup->next++;
+	}
+
+      nloaded = pgbuf_read_ahead_execute (thread_p, &request);
+      warmup->loaded += nloaded;
+      perfmon_add_stat (thread_p, PSTAT_PB_WARMUP_PAGES, nloaded);
+      nwindows++;
+
+      /* do not delay the scans waiting for read-ahead */
+      while (pgbuf_Pool.read_ahead_requests->consume (request))
+	{
+	  (void) pgbuf_read_ahead_execute (thread_p, &request);
+	}
+    }
+
+  if (warmup->next >= warmup->npages || pgbuf_Pool.buf_invalid_list.invalid_cnt <= 0)
+    {
+      /* warm-up is finished */
+      er_log_debug (ARG_FILE_LINE, "pgbuf_warmup_execute: %d of %d pages were reloaded.\n", warmup->loaded,
+		    warmup->npages);
+      free_and_init (warmup->vpids);
+    }
+}
+#endif /* SERVER_MODE */
+
+/*
+ * pgbuf_get_page_flush_interval () - setup page flush daemon period based on system parameter
+ */
+void
+pgbuf_get_page_flush_interval (bool & is_timed_wait, cubthread::delta_time & period)
+{
+  int page_flush_interval_msecs = prm_get_integer_value (PRM_ID_PAGE_BG_FLUSH_INTERVAL_MSECS);
+
+  assert (page_flush_interval_msecs >= 0);
+
+  if (page_flush_interval_msecs > 0)
+    {
+      // if page_flush_interval_msecs > 0 (zero) then loop for fixed interval
+      is_timed_wait = true;
+      period = std::chrono::milliseconds (page_flush_interval_msecs);
+    }
+  else
+    {
+      // infinite wait
+      is_timed_wait = false;
+    }
+}
+
+// *INDENT-OFF*
+#if defined (SERVER_MODE)
+static void
+pgbuf_page_maintenance_execute (cubthread::entry & thread_ref)
+{
+  if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
+      {
+        return;
+      }
+
+  /* page buffer maintenance thread adjust quota's based on thread activity. */
+  pgbuf_adjust_quotas (&thread_ref);
+
+  /* search lists and assign victims directly */
+  pgbuf_direct_victims_maintenance (&thread_ref);
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+// class pgbuf_page_flush_daemon_task
+//
+//  description:
+//    page flush daemon task
+//
+class pgbuf_page_flush_daemon_task : public cubthread::entry_task
+{
+  private:
+    PERF_UTIME_TRACKER m_perf_track;
+
+  public:
+    pgbuf_page_flush_daemon_task ()
+    {
+      PERF_UTIME_TRACKER_START (NULL, &m_perf_track);
+    }
+
+    void execute (cubthread::entry & thread_ref) override
+    {
+      if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
+        {
+          return;
+        }
+
+      // did not timeout, someone requested flush... run at least once
+      bool force_one_run = pgbuf_Page_flush_daemon->was_woken_up ();
+      bool stop_iteration = false;
+
+      /* flush pages as long as necessary */
+      while (force_one_run || pgbuf_keep_victim_flush_thread_running ())
+	{
+	  pgbuf_flush_victim_candidates (&thread_ref, prm_get_float_value (PRM_ID_PB_BUFFER_FLUSH_RATIO), &m_perf_track,
+					 &stop_iteration);
+	  force_one_run = false;
+	  if (stop_iteration)
+	    {
+	      break;
+	    }
+	}
+
+      /* performance tracking */
+      if (m_perf_track.is_perf_tracking)
+	{
+	  /* register sleep time. */
+	  PERF_UTIME_TRACKER_TIME_AND_RESTART (&thread_ref, &m_perf_track, PSTAT_PB_FLUSH_SLEEP);
+
+	  /* update is_perf_tracking */
+	  m_perf_track.is_perf_tracking = perfmon_is_perf_tracking ();
+	}
+      else
+	{
+	  /* update is_perf_tracking and start timer if it became true */
+	  PERF_UTIME_TRACKER_START (&thread_ref, &m_perf_track);
+	}
+    }
+};
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+static void
+pgbuf_page_post_flush_execute (cubthread::entry & thread_ref)
+{
+  if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
+    {
+      return;
+    }
+
+  /* assign flushed pages */
+  if (pgbuf_assign_flushed_pages (&thread_ref))
+    {
+      /* reset daemon looper and be prepared to start over */
+      pgbuf_Page_post_flush_daemon->reset_looper ();
+    }
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+// class pgbuf_flush_control_daemon_task
+//
+//  description:
+//    flush control daemon task
+//
+class pgbuf_flush_control_daemon_task : public cubthread::entry_task
+{
+  private:
+    struct timeval m_end;
+    bool m_first_run;
+
+  public:
+    pgbuf_flush_control_daemon_task ()
+      : m_end ({0, 0})
+      , m_first_run (true)
+    {
+    }
+
+    int initialize ()
+    {
+      return fileio_flush_control_initialize ();
+    }
+
+    void execute (cubthread::entry & thread_ref) override
+    {
+      if (!BO_IS_FLUSH_DAEMON_AVAILABLE ())
+        {
+          return;
+        }
+
+      if (m_first_run)
+	{
+	  gettimeofday (&m_end, NULL);
+	  m_first_run = false;
+	  return;
+	}
+
+      struct timeval begin, diff;
+      int token_gen, token_consumed;
+
+      gettimeofday (&begin, NULL);
+      perfmon_diff_timeval (&diff, &m_end, &begin);
+
+      int64_t diff_usec = diff.tv_sec * 1000000LL + diff.tv_usec;
+      fileio_flush_control_add_tokens (&thread_ref, diff_usec, &token_gen, &token_consumed);
+
+      gettimeofday (&m_end, NULL);
+    }
+
+    void retire (void) override
+    {
+      fileio_flush_control_finalize ();
+      delete this;
+    }
+};
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+static void
+pgbuf_read_ahead_daemon_execute (cubthread::entry & thread_ref)
+{
+  PGBUF_READ_AHEAD_REQUEST request;
+  int dump_interval;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      return;
+    }
+
+  if (!pgbuf_Pool.warmup.is_started)
+    {
+      pgbuf_warmup_start (&thread_ref);
+    }
+
+  /* load all requested windows */
+  while (pgbuf_Pool.read_ahead_requests->consume (request))
+    {
+      (void) pgbuf_read_ahead_execute (&thread_ref, &request);
+    }
+
+  /* reload the pages that were hot before server start */
+  pgbuf_warmup_execute (&thread_ref);
+
+  dump_interval = prm_get_integer_value (PRM_ID_PB_WARMUP_DUMP_INTERVAL_SECS);
+  if (dump_interval > 0 && difftime (time (NULL), pgbuf_Pool.warmup.last_dump_time) >= dump_interval)
+    {
+      pgbuf_warmup_dump (&thread_ref);
+    }
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_maintenance_daemon_init () - initialize page maintenance daemon thread
+ */
+void
+pgbuf_page_maintenance_daemon_init ()
+{
+  assert (pgbuf_Page_maintenance_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_page_maintenance_execute);
+
+  pgbuf_Page_maintenance_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
+                                                                            "pgbuf_page_maintenance");
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_flush_daemon_init () - initialize page flush daemon thread
+ */
+void
+pgbuf_page_flush_daemon_init ()
+{
+  assert (pgbuf_Page_flush_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (pgbuf_get_page_flush_interval);
+  pgbuf_page_flush_daemon_task *daemon_task = new pgbuf_page_flush_daemon_task ();
+
+  pgbuf_Page_flush_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "pgbuf_page_flush");
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_post_flush_daemon_init () - initialize page post flush daemon thread
+ */
 void
 pgbuf_page_post_flush_daemon_init ()
 {
@@ -15956,6 +18077,22 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_read_ahead_daemon_init () - initialize read-ahead daemon thread
+ */
+void
+pgbuf_read_ahead_daemon_init ()
+{
+  assert (pgbuf_Read_ahead_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_read_ahead_daemon_execute);
+
+  pgbuf_Read_ahead_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "pgbuf_read_ahead");
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -15967,6 +18104,7 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_read_ahead_daemon_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -15981,6 +18119,7 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Read_ahead_daemon);
 }
 #endif /* SERVER_MODE */
 
@@ -16140,7 +18279,7 @@ int
 pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
 {
   SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
-  const int num_cols = 19;
+  const int num_cols = 21;
   time_t cur_time;
   int idx, i;
   int error = NO_ERROR;
@@ -16275,6 +18414,20 @@ pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int
   db_make_int (&vals[idx], status_accumulated.num_flusher_waiting_threads);
   idx++;
 
+#if defined (SERVER_MODE)
+  db_make_int (&vals[idx], pgbuf_Pool.warmup.npages);
+  idx++;
+
+  db_make_int (&vals[idx], pgbuf_Pool.warmup.loaded);
+  idx++;
+#else /* !SERVER_MODE */
+  db_make_int (&vals[idx], 0);
+  idx++;
+
+  db_make_int (&vals[idx], 0);
+  idx++;
+#endif /* !SERVER_MODE */
+
   assert (idx == num_cols);
 
   /* set now data to old data */
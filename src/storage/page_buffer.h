@@ -248,6 +248,15 @@ struct pgbuf_watcher
 #endif
 };
 
+/* optimistic read of a page, see pgbuf_read_optimistic () */
+typedef struct pgbuf_optimistic_read PGBUF_OPTIMISTIC_READ;
+struct pgbuf_optimistic_read
+{
+  PAGE_PTR pgptr;		/* page in buffer (not the copy) */
+  VPID vpid;
+  int version;
+};
+
 // *INDENT-OFF*
 using pgbuf_aligned_buffer = cubmem::stack_block<(size_t) IO_MAX_PAGE_SIZE>;
 using pgbuf_resizable_buffer = cubmem::extensible_stack_block<(size_t) IO_MAX_PAGE_SIZE>;
@@ -335,6 +344,9 @@ extern void pgbuf_ordered_unfix (THREAD_ENTRY * thread_p, PGBUF_WATCHER * watche
 extern int pgbuf_invalidate_all (THREAD_ENTRY * thread_p, VOLID volid);
 extern int pgbuf_invalidate (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
 #endif /* NDEBUG */
+extern PAGE_PTR pgbuf_read_optimistic (THREAD_ENTRY * thread_p, const VPID * vpid, char *copy_area,
+				       PGBUF_OPTIMISTIC_READ * read_p);
+extern bool pgbuf_is_optimistic_read_valid (const PGBUF_OPTIMISTIC_READ * read_p);
 extern PAGE_PTR pgbuf_flush_with_wal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
 extern void pgbuf_flush_if_requested (THREAD_ENTRY * thread_p, PAGE_PTR page);
 extern int pgbuf_flush_victim_candidates (THREAD_ENTRY * thread_p, float flush_ratio,
@@ -435,6 +447,12 @@ extern void pgbuf_peek_stats (UINT64 * fixed_cnt, UINT64 * dirty_cnt, UINT64 * l
 			      UINT64 * lfcq_shr_num);
 extern void pgbuf_daemons_get_stats (UINT64 * stats_out);
 
+extern void pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead);
+extern void pgbuf_read_ahead_notify (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * vpid);
+extern void pgbuf_bulk_read_begin (THREAD_ENTRY * thread_p);
+extern void pgbuf_bulk_read_end (THREAD_ENTRY * thread_p);
+extern bool pgbuf_is_bulk_read_scan (const PGBUF_READ_AHEAD * read_ahead);
+
 extern int pgbuf_flush_control_from_dirty_ratio (void);
 
 extern int pgbuf_rv_flush_page (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
@@ -485,6 +503,7 @@ extern bool pgbuf_is_io_stressful (void);
 #if defined (SERVER_MODE)
 extern void pgbuf_daemons_init ();
 extern void pgbuf_daemons_destroy ();
+extern void pgbuf_warmup_dump (THREAD_ENTRY * thread_p);
 #endif /* SERVER_MODE */
 
 extern int pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr);
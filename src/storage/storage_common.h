@@ -495,6 +495,19 @@ typedef enum
   S_UPDATE			/* Update object operation. */
 } SCAN_OPERATION_TYPE;
 
+/* Sequential read-ahead state of a page scan. It is owned by the scan (heap scan cache, list file scan, index range
+ * scan) and fed by pgbuf_read_ahead_notify () before each page fix. */
+typedef struct pgbuf_read_ahead PGBUF_READ_AHEAD;
+struct pgbuf_read_ahead
+{
+  VPID last_vpid;		/* last page accessed by scan */
+  VPID window_vpid;		/* first page of last window requested for read-ahead */
+  int window_npages;		/* number of pages in last window requested for read-ahead */
+  int seq_count;		/* number of consecutive forward accesses */
+  UINT64 hits;			/* sequential accesses to pages of a requested window */
+  UINT64 misses;		/* sequential accesses to pages that were not requested ahead */
+};
+
 #define IS_WRITE_EXCLUSIVE_LOCK(lock) ((lock) == X_LOCK || (lock) == SCH_M_LOCK)
 
 
@@ -422,6 +422,13 @@ namespace cubthread
     std::size_t max_active_workers = NUM_NON_SYSTEM_TRANS;  // one per each connection
     std::size_t max_conn_workers = NUM_NON_SYSTEM_TRANS;    // one per each connection
     std::size_t max_vacuum_workers = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT);
+#if defined (SERVER_MODE)
+    std::size_t max_sort_workers = system_core_count ();    // shared by parallel sorts
+    std::size_t max_heap_scan_workers = system_core_count ();   // shared by parallel heap scans
+#else // not SERVER_MODE = SA_MODE
+    std::size_t max_sort_workers = 0;
+    std::size_t max_heap_scan_workers = 0;
+#endif // not SERVER_MODE = SA_MODE
     std::size_t max_daemons = 128;  // magic number to cover predictable requirements; not cool
 
     // note: thread entry initialization is slow, that is why we keep a static pool initialized from the beginning to
@@ -429,7 +436,8 @@ namespace cubthread
     //       generated at "runtime" (after thread starts its task). however, with current thread entry design, that is
     //       rather unlikely.
 
-    m_max_threads = max_active_workers + max_conn_workers + max_vacuum_workers + max_daemons;
+    m_max_threads = (max_active_workers + max_conn_workers + max_vacuum_workers + max_sort_workers
+		     + max_heap_scan_workers + max_daemons);
   }
 
   void
@@ -514,6 +522,11 @@ namespace cubthread
 	// perf tool needs threads to be always alive to work
 	wp_set_force_thread_always_alive ();
       }
+    if (prm_get_bool_value (PRM_ID_THREAD_WORKER_NUMA_PINNING))
+      {
+	// spread worker pool cores over NUMA nodes
+	wp_set_numa_pinning ();
+      }
 #endif // SERVER_MODE
   }
 
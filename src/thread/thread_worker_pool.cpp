@@ -23,6 +23,7 @@
 #include "thread_worker_pool.hpp"
 
 #include "error_manager.h"
+#include "porting.h"
 #include "perf.hpp"
 
 #include <sstream>
@@ -47,6 +48,35 @@ namespace cubthread
     FORCE_THREAD_ALWAYS_ALIVE = true;
   }
 
+  // number of NUMA nodes that worker pool cores are spread over; 0 if workers are not pinned
+  static int NUMA_PINNING_NODE_COUNT = 0;
+
+  void
+  wp_set_numa_pinning ()
+  {
+    int node_count = os_numa_get_node_count ();
+
+    // pinning is useless on a single node
+    NUMA_PINNING_NODE_COUNT = node_count > 1 ? node_count : 0;
+  }
+
+  int
+  wp_get_numa_node_of_core (std::size_t core_index)
+  {
+    if (NUMA_PINNING_NODE_COUNT == 0)
+      {
+	return -1;
+      }
+    return (int) (core_index % NUMA_PINNING_NODE_COUNT);
+  }
+
+  void
+  wp_bind_thread_to_numa_node (int node)
+  {
+    // failure is not critical; thread runs wherever the system schedules it
+    (void) os_numa_bind_thread_to_node (node);
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // statistics
   //////////////////////////////////////////////////////////////////////////
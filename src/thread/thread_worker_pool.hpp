@@ -336,6 +336,7 @@ namespace cubthread
       ~core (void);
 
       worker_pool_type *m_parent_pool;                // pointer to parent pool
+      int m_numa_node;                                // NUMA node that core workers are pinned to; -1 if not pinned
       std::size_t m_max_workers;                      // maximum number of workers running at once
       worker *m_worker_array;                         // all core workers
       worker **m_available_workers;
@@ -536,6 +537,11 @@ namespace cubthread
   bool wp_is_thread_always_alive_forced ();
   void wp_set_force_thread_always_alive ();
 
+  // NUMA placement of worker pool cores; node is -1 if workers are not pinned
+  void wp_set_numa_pinning ();
+  int wp_get_numa_node_of_core (std::size_t core_index);
+  void wp_bind_thread_to_numa_node (int node);
+
   /************************************************************************/
   /* Template/inline implementation                                       */
   /************************************************************************/
@@ -583,10 +589,12 @@ namespace cubthread
 
     for (; it < remainder; it++)
       {
+	m_core_array[it].m_numa_node = wp_get_numa_node_of_core (it);
 	m_core_array[it].init_pool_and_workers (*this, quotient + 1);
       }
     for (; it < m_core_count; it++)
       {
+	m_core_array[it].m_numa_node = wp_get_numa_node_of_core (it);
 	m_core_array[it].init_pool_and_workers (*this, quotient);
       }
 
@@ -848,6 +856,7 @@ namespace cubthread
   template <typename Context>
   worker_pool<Context>::core::core ()
     : m_parent_pool (NULL)
+    , m_numa_node (-1)
     , m_max_workers (0)
     , m_worker_array (NULL)
     , m_available_workers (NULL)
@@ -1360,6 +1369,12 @@ namespace cubthread
     m_statistics.m_timept = m_push_time;
     wp_worker_statset_time_and_increment (m_statistics, Wpstat_start_thread);
 
+    if (m_parent_core->m_numa_node >= 0)
+      {
+	// keep the thread close to the memory it allocates
+	wp_bind_thread_to_numa_node (m_parent_core->m_numa_node);
+      }
+
     // a context is required
     m_context_p = &m_parent_core->get_context_manager ().create_context ();
     wp_worker_statset_time_and_increment (m_statistics, Wpstat_create_context);
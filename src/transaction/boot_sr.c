@@ -80,6 +80,7 @@
 #include "xasl_cache.h"
 #include "log_volids.hpp"
 #include "vacuum.h"
+#include "external_sort.h"
 #include "tde.h"
 #include "porting.h"
 #include "log_manager.h"
@@ -2519,6 +2520,8 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       goto error;
     }
 
+  sort_initialize_parallel_workers ();
+
   /*
    * Initialize the catalog manager, the query evaluator, and install meta
    * classes
@@ -2818,6 +2821,7 @@ error:
 
   vacuum_stop_workers (thread_p);
   vacuum_stop_master (thread_p);
+  sort_finalize_parallel_workers ();
 
 #if defined(SERVER_MODE)
   cdc_daemons_destroy ();
@@ -3137,6 +3141,8 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
 
 #if defined(SERVER_MODE)
   pgbuf_daemons_destroy ();
+  /* save hot pages for the warm-up of next start; daemons no longer change the buffer */
+  pgbuf_warmup_dump (thread_p);
   cdc_daemons_destroy ();
 #endif
 
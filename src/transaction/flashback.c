@@ -299,6 +299,9 @@ flashback_make_summary_list (THREAD_ENTRY * thread_p, FLASHBACK_SUMMARY_CONTEXT
   char *supplement_data = NULL;
   int supplement_alloc_length = 0;
 
+  /* log is traversed backwards, from end_lsa to start_lsa */
+  LOG_READ_AHEAD read_ahead = LOG_READ_AHEAD_BACKWARD_INITIALIZER;
+
   log_page_p = (LOG_PAGE *) PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
   assert (!LSA_ISNULL (&context->end_lsa));
@@ -306,6 +309,7 @@ flashback_make_summary_list (THREAD_ENTRY * thread_p, FLASHBACK_SUMMARY_CONTEXT
   LSA_COPY (&process_lsa, &(context->end_lsa));
 
   /*fetch log page */
+  logpb_read_ahead (thread_p, &read_ahead, process_lsa.pageid);
   error = logpb_fetch_page (thread_p, &process_lsa, LOG_CS_SAFE_READER, log_page_p);
   if (error != NO_ERROR)
     {
@@ -487,6 +491,7 @@ flashback_make_summary_list (THREAD_ENTRY * thread_p, FLASHBACK_SUMMARY_CONTEXT
 
       if (process_lsa.pageid != log_page_p->hdr.logical_pageid)
 	{
+	  logpb_read_ahead (thread_p, &read_ahead, process_lsa.pageid);
 	  error = logpb_fetch_page (thread_p, &process_lsa, LOG_CS_SAFE_READER, log_page_p);
 	  if (error != NO_ERROR)
 	    {
@@ -776,6 +781,8 @@ flashback_make_loginfo (THREAD_ENTRY * thread_p, FLASHBACK_LOGINFO_CONTEXT * con
 
   OID classoid;
 
+  LOG_READ_AHEAD read_ahead = LOG_READ_AHEAD_INITIALIZER;
+
   if (LSA_ISNULL (&context->start_lsa))
     {
       error = flashback_find_start_lsa (thread_p, context);
@@ -795,6 +802,7 @@ flashback_make_loginfo (THREAD_ENTRY * thread_p, FLASHBACK_LOGINFO_CONTEXT * con
   else
     {
       LSA_COPY (&process_lsa, &context->end_lsa);
+      read_ahead.is_backward = true;
     }
 
   LSA_COPY (&cur_log_rec_lsa, &process_lsa);
@@ -802,6 +810,7 @@ flashback_make_loginfo (THREAD_ENTRY * thread_p, FLASHBACK_LOGINFO_CONTEXT * con
   log_page_p = (LOG_PAGE *) PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
   /* fetch log page */
+  logpb_read_ahead (thread_p, &read_ahead, process_lsa.pageid);
   error = logpb_fetch_page (thread_p, &process_lsa, LOG_CS_SAFE_READER, log_page_p);
   if (error != NO_ERROR)
     {
@@ -817,6 +826,7 @@ flashback_make_loginfo (THREAD_ENTRY * thread_p, FLASHBACK_LOGINFO_CONTEXT * con
     {
       if (log_page_p->hdr.logical_pageid != process_lsa.pageid)
 	{
+	  logpb_read_ahead (thread_p, &read_ahead, process_lsa.pageid);
 	  error = logpb_fetch_page (thread_p, &process_lsa, LOG_CS_SAFE_READER, log_page_p);
 	  if (error != NO_ERROR)
 	    {
@@ -12943,6 +12943,7 @@ locator_lock_and_get_object_internal (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT
 {
   SCAN_CODE scan = S_SUCCESS;
   bool lock_acquired = false;
+  bool is_lock_inflated = false;
 
   assert (context != NULL);
   assert (context->oid_p != NULL && !OID_ISNULL (context->oid_p));
@@ -12981,6 +12982,7 @@ locator_lock_and_get_object_internal (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT
 
   assert (OID_IS_ROOTOID (context->class_oid_p) || lock_mode == S_LOCK || lock_mode == X_LOCK);
 
+get_object:
   /* Lock should be aquired now -> get recdes */
   if (context->recdes_p != NULL)
     {
@@ -13017,6 +13019,41 @@ locator_lock_and_get_object_internal (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT
 	  goto error;
 	}
 
+#if defined (SERVER_MODE)
+      if (!is_lock_inflated && prm_get_bool_value (PRM_ID_LK_ELIDE_INSERT_LOCKS)
+	  && mvcc_satisfies_delete (thread_p, &recdes_header) == DELETE_RECORD_INSERT_IN_PROGRESS)
+	{
+	  /* We got the lock while the inserter is still active, so the inserter left its lock to the insert MVCCID.
+	   * Give ours back, make the inserter's lock real and wait for it. */
+	  lock_unlock_object_donot_move_to_non2pl (thread_p, context->oid_p, context->class_oid_p, lock_mode);
+	  lock_acquired = false;
+	  if (context->scan_cache && context->scan_cache->cache_last_fix_page
+	      && context->home_page_watcher.pgptr != NULL)
+	    {
+	      /* prevent caching home page watcher in scan_cache */
+	      pgbuf_ordered_unfix (thread_p, &context->home_page_watcher);
+	    }
+	  heap_clean_get_context (thread_p, context);
+	  (void) lock_inflate_elided_object_lock (thread_p, context->oid_p, context->class_oid_p,
+						  recdes_header.mvcc_ins_id);
+	  is_lock_inflated = true;
+
+	  if (lock_object (thread_p, context->oid_p, context->class_oid_p, lock_mode, LK_UNCOND_LOCK) != LK_GRANTED)
+	    {
+	      scan = S_ERROR;
+	      goto error;
+	    }
+	  lock_acquired = true;
+
+	  scan = heap_prepare_get_context (thread_p, context, false, LOG_WARNING_IF_DELETED);
+	  if (scan != S_SUCCESS)
+	    {
+	      goto error;
+	    }
+	  goto get_object;
+	}
+#endif /* SERVER_MODE */
+
       /* Check REPEATABLE READ/SERIALIZABLE isolation restrictions. */
       if (logtb_find_current_isolation (thread_p) > TRAN_READ_COMMITTED
 	  && logtb_check_class_for_rr_isolation_err (context->class_oid_p))
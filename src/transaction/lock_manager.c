@@ -91,6 +91,11 @@ extern LOCK_COMPATIBILITY lock_Comp[12][12];
 /* is younger transaction ? */
 #define LK_ISYOUNGER(young_tranid, old_tranid) (young_tranid > old_tranid)
 
+/* wait-for edges sampled per waiter and bounds of the cycle check done on suspend */
+#define LK_MAX_SAMPLED_BLOCKERS 4
+#define LK_MAX_WAIT_FOR_CYCLE_DEPTH 8
+#define LK_MAX_WAIT_FOR_CYCLE_VISITS 64
+
 /* Defines for printing lock activity messages */
 #define LK_MSG_LOCK_HELPER(entry, msgnum) \
   fprintf(stdout, \
@@ -260,6 +265,8 @@ struct lk_WFG_node
   int tran_edge_seq_num;
   bool checked_by_deadlock_detector;
   bool DL_victim;
+  int num_blockers;		/* # of sampled wait-for edges maintained by lock_suspend */
+  int blockers[LK_MAX_SAMPLED_BLOCKERS];	/* sampled blocking transactions */
 };
 
 typedef struct lk_WFG_edge LK_WFG_EDGE;
@@ -376,6 +383,7 @@ struct lk_global_data
   bool verbose_mode;
   // *INDENT-OFF*
   std::atomic_int deadlock_and_timeout_detector;
+  std::atomic_bool deadlock_suspected;	/* a wait-for cycle was found when a waiter suspended */
   // *INDENT-ON*
 #if defined(LK_DUMP)
   bool dump_level;
@@ -398,6 +406,7 @@ struct lk_global_data
     , no_victim_case_count (0)
     , verbose_mode (false)
     , deadlock_and_timeout_detector { 0 }
+    , deadlock_suspected { false }
 #if defined(LK_DUMP)
     , dump_level (0)
 #endif
@@ -503,6 +512,8 @@ static void lock_set_error_for_timeout (THREAD_ENTRY * thread_p, LK_ENTRY * entr
 static void lock_set_error_for_aborted (LK_ENTRY * entry_ptr);
 static void lock_set_tran_abort_reason (int tran_index, TRAN_ABORT_REASON abort_reason);
 static LOCK_WAIT_STATE lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs);
+static void lock_sample_wait_for_edges (LK_RES * res_ptr, LK_ENTRY * entry_ptr);
+static bool lock_detect_wait_for_cycle (int tran_index);
 static void lock_resume (LK_ENTRY * entry_ptr, int state);
 static bool lock_wakeup_deadlock_victim_timeout (int tran_index);
 static bool lock_wakeup_deadlock_victim_aborted (int tran_index);
@@ -540,6 +551,7 @@ static void lock_increment_class_granules (LK_ENTRY * class_entry);
 
 static void lock_decrement_class_granules (LK_ENTRY * class_entry);
 static LK_ENTRY *lock_find_class_entry (int tran_index, const OID * class_oid);
+static LK_ENTRY *lock_find_class_entry_in_hold_list (LK_TRAN_LOCK * tran_lock, int tran_index, const OID * class_oid);
 
 static void lock_event_log_tran_locks (THREAD_ENTRY * thread_p, FILE * log_fp, int tran_index);
 static void lock_event_log_blocked_lock (THREAD_ENTRY * thread_p, FILE * log_fp, LK_ENTRY * entry);
@@ -1187,6 +1199,7 @@ lock_initialize_deadlock_detection (void)
       lk_Gl.TWFG_node[i].DL_victim = false;
       lk_Gl.TWFG_node[i].checked_by_deadlock_detector = false;
       lk_Gl.TWFG_node[i].thrd_wait_stime = 0;
+      lk_Gl.TWFG_node[i].num_blockers = 0;
     }
 
   /* initialize other related fields */
@@ -1595,6 +1608,29 @@ lock_find_class_entry (int tran_index, const OID * class_oid)
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
   rv = pthread_mutex_lock (&tran_lock->hold_mutex);
 
+  entry_ptr = lock_find_class_entry_in_hold_list (tran_lock, tran_index, class_oid);
+
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  return entry_ptr;		/* it might be NULL */
+}
+
+/*
+ * lock_find_class_entry_in_hold_list - Find a class lock entry in the transaction lock hold list
+ *
+ * return:
+ *
+ *   tran_lock(in):
+ *   tran_index(in):
+ *   class_oid(in):
+ *
+ * Note: The caller is holding tran_lock->hold_mutex.
+ */
+static LK_ENTRY *
+lock_find_class_entry_in_hold_list (LK_TRAN_LOCK * tran_lock, int tran_index, const OID * class_oid)
+{
+  LK_ENTRY *entry_ptr;
+
   if (OID_IS_ROOTOID (class_oid))
     {
       entry_ptr = tran_lock->root_class_hold;
@@ -1614,8 +1650,6 @@ lock_find_class_entry (int tran_index, const OID * class_oid)
 	}
     }
 
-  pthread_mutex_unlock (&tran_lock->hold_mutex);
-
   return entry_ptr;		/* it might be NULL */
 }
 #endif /* SERVER_MODE */
@@ -2189,6 +2223,17 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = entry_ptr->thrd_entry->lockwait_stime;
   lk_Gl.deadlock_and_timeout_detector++;
 
+  /* check only the component reachable from the new wait-for edges; the daemon resolves the cycle */
+  if (lock_detect_wait_for_cycle (entry_ptr->tran_index))
+    {
+      perfmon_inc_stat (thread_p, PSTAT_LK_NUM_DEADLOCK_CYCLES_ON_SUSPEND);
+      lk_Gl.deadlock_suspected = true;
+      if (lock_Deadlock_detect_daemon != NULL)
+	{
+	  lock_Deadlock_detect_daemon->wakeup ();
+	}
+    }
+
   tdes = LOG_FIND_CURRENT_TDES (thread_p);
 
   /* I must not be a deadlock-victim thread */
@@ -2206,6 +2251,7 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
 
   lk_Gl.deadlock_and_timeout_detector--;
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = 0;
+  lk_Gl.TWFG_node[entry_ptr->tran_index].num_blockers = 0;
 
   if (tdes)
     {
@@ -2327,6 +2373,126 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
 }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+/*
+ * lock_sample_wait_for_edges - Record the transactions that block a lock waiter
+ *
+ * return: nothing
+ *
+ *   res_ptr(in): lock resource the waiter is blocked on
+ *   entry_ptr(in): lock entry of the waiter
+ *
+ * Note: The caller is holding the resource mutex. At most LK_MAX_SAMPLED_BLOCKERS wait-for edges are kept per
+ *       transaction; they are only a hint for lock_detect_wait_for_cycle and the deadlock detector still builds the
+ *       exact wait-for graph before choosing a victim.
+ */
+static void
+lock_sample_wait_for_edges (LK_RES * res_ptr, LK_ENTRY * entry_ptr)
+{
+  LK_WFG_NODE *node;
+  LK_ENTRY *hi;
+  int i, n = 0;
+
+  node = &lk_Gl.TWFG_node[entry_ptr->tran_index];
+  node->num_blockers = 0;
+
+  for (hi = res_ptr->holder; hi != NULL && n < LK_MAX_SAMPLED_BLOCKERS; hi = hi->next)
+    {
+      if (hi == entry_ptr || hi->tran_index == entry_ptr->tran_index)
+	{
+	  continue;
+	}
+
+      assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+      if (lock_Comp[entry_ptr->blocked_mode][hi->granted_mode] != LOCK_COMPAT_NO
+	  && lock_Comp[entry_ptr->blocked_mode][hi->blocked_mode] != LOCK_COMPAT_NO)
+	{
+	  continue;
+	}
+
+      for (i = 0; i < n; i++)
+	{
+	  if (node->blockers[i] == hi->tran_index)
+	    {
+	      break;
+	    }
+	}
+      if (i == n)
+	{
+	  node->blockers[n++] = hi->tran_index;
+	}
+    }
+
+  node->num_blockers = n;
+}
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+/*
+ * lock_detect_wait_for_cycle - Check whether a new waiter closes a wait-for cycle
+ *
+ * return: true if a cycle through tran_index was found
+ *
+ *   tran_index(in): transaction that is about to suspend
+ *
+ * Note: Only the component reachable from the sampled edges of tran_index is visited, bounded by
+ *       LK_MAX_WAIT_FOR_CYCLE_DEPTH and LK_MAX_WAIT_FOR_CYCLE_VISITS. The edges are read without latching, so the
+ *       result may be stale; a positive answer just brings the deadlock detector forward.
+ */
+static bool
+lock_detect_wait_for_cycle (int tran_index)
+{
+  int stack_tran[LK_MAX_WAIT_FOR_CYCLE_DEPTH];
+  int stack_edge[LK_MAX_WAIT_FOR_CYCLE_DEPTH];
+  int depth, visits = 0;
+  int t, n;
+  LK_WFG_NODE *node;
+
+  if (lk_Gl.TWFG_node[tran_index].num_blockers == 0)
+    {
+      return false;
+    }
+
+  depth = 0;
+  stack_tran[0] = tran_index;
+  stack_edge[0] = 0;
+
+  while (depth >= 0)
+    {
+      node = &lk_Gl.TWFG_node[stack_tran[depth]];
+      n = MIN (node->num_blockers, LK_MAX_SAMPLED_BLOCKERS);
+      if (stack_edge[depth] >= n)
+	{
+	  depth--;
+	  continue;
+	}
+
+      t = node->blockers[stack_edge[depth]++];
+      if (t == tran_index)
+	{
+	  return true;
+	}
+      if (t <= 0 || t >= lk_Gl.num_trans || lk_Gl.TWFG_node[t].thrd_wait_stime == 0
+	  || lk_Gl.TWFG_node[t].num_blockers == 0 || depth + 1 >= LK_MAX_WAIT_FOR_CYCLE_DEPTH)
+	{
+	  /* not waiting, or beyond the part of the graph we are willing to look at */
+	  continue;
+	}
+
+      if (++visits > LK_MAX_WAIT_FOR_CYCLE_VISITS)
+	{
+	  break;
+	}
+
+      depth++;
+      stack_tran[depth] = t;
+      stack_edge[depth] = 0;
+    }
+
+  return false;
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * lk_resume - Resume the thread (transaction)
@@ -3848,6 +4014,11 @@ blocked:
   LK_MSG_LOCK_WAITFOR (entry_ptr);
 #endif /* LK_TRACE_OBJECT */
 
+  if (is_res_mutex_locked)
+    {
+      lock_sample_wait_for_edges (res_ptr, entry_ptr);
+    }
+
   thread_lock_entry (entry_ptr->thrd_entry);
   if (is_res_mutex_locked)
     {
@@ -5793,9 +5964,15 @@ deadlock_detect_task_execute (cubthread::entry & thread_ref)
   size_t lock_wait_count = 0;
   thread_get_manager ()->map_entries (lock_check_timeout_expired_and_count_suspended_mapfunc, lock_wait_count);
 
-  if (lock_is_local_deadlock_detection_interval_up () && lock_wait_count >= 2)
+  /* a cycle found on suspend does not wait for the detection interval */
+  if (lock_wait_count >= 2
+      && (lk_Gl.deadlock_suspected.exchange (false) || lock_is_local_deadlock_detection_interval_up ()))
     {
+      PERF_UTIME_TRACKER time_track;
+
+      PERF_UTIME_TRACKER_START (&thread_ref, &time_track);
       lock_detect_local_deadlock (&thread_ref);
+      PERF_UTIME_TRACKER_TIME (&thread_ref, &time_track, PSTAT_LK_DEADLOCK_DETECT_TIME_COUNTERS);
     }
 }
 #endif /* SERVER_MODE */
@@ -6134,6 +6311,114 @@ end:
 #endif /* !SERVER_MODE */
 }
 
+/*
+ * lock_inflate_elided_object_lock () - Materialize the instance lock an inserter did not acquire
+ *
+ * return: true if the lock was materialized on behalf of the inserter and the caller has to wait for it
+ *
+ *   oid(in): Identifier of the inserted instance
+ *   class_oid(in): Identifier of the class of the instance
+ *   insert_mvccid(in): insert MVCCID read from the record header or from the index entry
+ *
+ * Note: With lock_elide_insert_locks, an instance inserted into a new slot is not locked; its insert MVCCID in the
+ *       record header stands for the X_LOCK. A transaction that finds such an instance while the inserter is still
+ *       active calls this function before locking the instance, so that the conflict is resolved by the lock
+ *       manager as if the inserter had locked it. The inserter releases the lock when it completes.
+ *
+ *       The lock is granted directly to the inserter, without escalation and without counting it in the granules of
+ *       the inserter's class lock, which belong to the inserter. The inserter's hold_mutex is held while it is
+ *       checked that the inserter is still active and still holds its class lock, and until the lock is in its hold
+ *       list. lock_unlock_all () takes that mutex before it releases anything, so the lock is either added before the
+ *       inserter releases its locks, and released with them, or not added at all.
+ */
+bool
+lock_inflate_elided_object_lock (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid,
+				 MVCCID insert_mvccid)
+{
+#if !defined (SERVER_MODE)
+  return false;
+#else /* !SERVER_MODE */
+  LF_TRAN_ENTRY *t_entry_ent = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_ENT);
+  int owner_tran_index;
+  LK_TRAN_LOCK *owner_tran_lock;
+  LK_ENTRY *class_entry;
+  LK_ENTRY *entry_ptr;
+  LK_RES_KEY search_key;
+  LK_RES *res_ptr = NULL;
+
+  if (!prm_get_bool_value (PRM_ID_LK_ELIDE_INSERT_LOCKS) || !MVCCID_IS_NORMAL (insert_mvccid)
+      || class_oid == NULL || OID_IS_ROOTOID (class_oid) || logtb_is_current_mvccid (thread_p, insert_mvccid)
+      || !log_Gl.mvcc_table.is_active (insert_mvccid))
+    {
+      return false;
+    }
+
+  owner_tran_index = logtb_find_tran_index_by_mvccid (thread_p, insert_mvccid);
+  if (owner_tran_index == NULL_TRAN_INDEX || owner_tran_index == LOG_FIND_THREAD_TRAN_INDEX (thread_p))
+    {
+      return false;
+    }
+  owner_tran_lock = &lk_Gl.tran_lock_table[owner_tran_index];
+
+  /* find or add the lockable object in the lock table; this also locks the resource mutex, which is always taken
+   * before a hold_mutex */
+  search_key = lock_create_search_key ((OID *) oid, (OID *) class_oid);
+  (void) lk_Gl.m_obj_hash_table.find_or_insert (thread_p, search_key, res_ptr);
+  if (res_ptr == NULL)
+    {
+      assert (false);
+      return false;
+    }
+
+  if (res_ptr->holder != NULL || res_ptr->waiter != NULL || res_ptr->non2pl != NULL)
+    {
+      /* somebody locked the instance already; it is not an elided lock anymore */
+      pthread_mutex_unlock (&res_ptr->res_mutex);
+      return false;
+    }
+
+  pthread_mutex_lock (&owner_tran_lock->hold_mutex);
+
+  class_entry = lock_find_class_entry_in_hold_list (owner_tran_lock, owner_tran_index, class_oid);
+  if (!log_Gl.mvcc_table.is_active (insert_mvccid) || class_entry == NULL
+      || lock_is_class_lock_escalated (class_entry->granted_mode, X_LOCK))
+    {
+      /* the inserter completed, or its class lock already makes us wait */
+      pthread_mutex_unlock (&owner_tran_lock->hold_mutex);
+      (void) lock_remove_resource (thread_p, res_ptr);
+      return false;
+    }
+
+  entry_ptr = lock_get_new_entry (owner_tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
+  if (entry_ptr == NULL)
+    {
+      pthread_mutex_unlock (&owner_tran_lock->hold_mutex);
+      (void) lock_remove_resource (thread_p, res_ptr);
+      return false;
+    }
+
+  /* grant the lock to the inserter */
+  lock_initialize_resource_as_allocated (res_ptr, X_LOCK);
+  lock_initialize_entry_as_granted (entry_ptr, owner_tran_index, res_ptr, X_LOCK);
+  res_ptr->holder = entry_ptr;
+
+  /* add the lock entry into the inserter's hold list */
+  if (owner_tran_lock->inst_hold_list != NULL)
+    {
+      owner_tran_lock->inst_hold_list->tran_prev = entry_ptr;
+    }
+  entry_ptr->tran_next = owner_tran_lock->inst_hold_list;
+  owner_tran_lock->inst_hold_list = entry_ptr;
+  owner_tran_lock->inst_hold_count++;
+
+  pthread_mutex_unlock (&owner_tran_lock->hold_mutex);
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_INFLATED_ON_OBJECTS);
+  return true;
+#endif /* !SERVER_MODE */
+}
+
 /*
  * lock_subclass () - Lock a class in a class hierarchy
  *
@@ -6867,6 +7152,11 @@ lock_unlock_all (THREAD_ENTRY * thread_p)
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
+  /* wait for an instance lock that lock_inflate_elided_object_lock () is adding to the hold list; the MVCCID of the
+   * transaction is completed, so no lock is added afterwards */
+  pthread_mutex_lock (&tran_lock->hold_mutex);
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
   /* remove all instance locks */
   entry_ptr = tran_lock->inst_hold_list;
   while (entry_ptr != NULL)
@@ -7939,6 +8229,7 @@ lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
 	  if (TWFG_node[t].ancestor != -1)
 	    {
 	      /* A deadlock cycle is found */
+	      perfmon_inc_stat (thread_p, PSTAT_LK_NUM_DEADLOCK_CYCLES);
 	      lock_select_deadlock_victim (thread_p, s, t);
 	      if (victim_count >= LK_MAX_VICTIM_COUNT)
 		{
@@ -28,6 +28,8 @@
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"
 #include "vacuum.h"
+
+#include <thread>
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
 
@@ -71,6 +73,10 @@ static void prior_lsa_end_append (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node);
 static void prior_lsa_append_data (int length);
 static LOG_LSA prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes,
     int with_lock);
+static LOG_LSA prior_lsa_link_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes);
+#if defined (SERVER_MODE)
+static LOG_LSA prior_lsa_combine_and_link_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes);
+#endif /* SERVER_MODE */
 static void prior_update_header_mvcc_info (const LOG_LSA &record_lsa, MVCCID mvccid);
 static char *log_append_get_data_ptr (THREAD_ENTRY *thread_p);
 static bool log_append_realloc_data_ptr (THREAD_ENTRY *thread_p, int length);
@@ -122,6 +128,7 @@ log_prior_lsa_info::log_prior_lsa_info ()
   , list_size (0)
   , prior_flush_list_header (NULL)
   , prior_lsa_mutex ()
+  , combine_list_header (NULL)
 {
 }
 
@@ -1345,16 +1352,17 @@ prior_update_header_mvcc_info (const LOG_LSA &record_lsa, MVCCID mvccid)
 }
 
 /*
- * prior_lsa_next_record_internal -
+ * prior_lsa_link_record - assign the LSA of a log record and append it to prior list
  *
  * return: start lsa of log record
  *
  *   node(in/out):
  *   tdes(in/out):
- *   with_lock(in):
+ *
+ * NOTE: prior_lsa_mutex must be held.
  */
 static LOG_LSA
-prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes, int with_lock)
+prior_lsa_link_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes)
 {
   LOG_LSA start_lsa;
   LOG_REC_MVCC_UNDO *mvcc_undo = NULL;
@@ -1362,11 +1370,6 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
   LOG_VACUUM_INFO *vacuum_info = NULL;
   MVCCID mvccid = MVCCID_NULL;
 
-  if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
-    {
-      log_Gl.prior_info.prior_lsa_mutex.lock ();
-    }
-
   prior_lsa_start_append (thread_p, node, tdes);
 
   LSA_COPY (&start_lsa, &node->start_lsa);
@@ -1515,10 +1518,140 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
   /* list_size in bytes */
   log_Gl.prior_info.list_size += (sizeof (LOG_PRIOR_NODE) + node->data_header_length + node->ulength + node->rlength);
 
+  /* node may be consumed by log flush as soon as prior_lsa_mutex is released */
+  return start_lsa;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * prior_lsa_combine_and_link_record - link a log record to prior list, together with the records of concurrent
+ *                                     threads
+ *
+ * return: start lsa of log record
+ *
+ *   node(in/out):
+ *   tdes(in/out):
+ *
+ * NOTE: The record is published to the combine list first. Whoever holds prior_lsa_mutex next links all published
+ *       records in one critical section, in publish order, so concurrent appenders do not hand the mutex over to each
+ *       other for every record. The owner of a record waits until its record is linked; its transaction descriptor
+ *       is not used meanwhile.
+ */
+static LOG_LSA
+prior_lsa_combine_and_link_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes)
+{
+  LOG_PRIOR_LSA_INFO *prior_info = &log_Gl.prior_info;
+  LOG_PRIOR_COMBINE_REQUEST request;
+  LOG_PRIOR_COMBINE_REQUEST *combine_list;
+  LOG_PRIOR_COMBINE_REQUEST *reversed;
+  LOG_PRIOR_COMBINE_REQUEST *next;
+  int spin;
+  int count_combined = 0;
+
+  /* publish the record */
+  request.node = node;
+  request.tdes = tdes;
+  LSA_SET_NULL (&request.start_lsa);
+  request.is_linked = 0;
+  request.next = prior_info->combine_list_header.load ();
+  while (!prior_info->combine_list_header.compare_exchange_weak (request.next, &request))
+    {
+      ;
+    }
+
+  /* wait for the combiner or become one */
+  for (spin = 0; !prior_info->prior_lsa_mutex.try_lock (); spin++)
+    {
+      if (ATOMIC_LOAD (&request.is_linked))
+	{
+	  return request.start_lsa;
+	}
+      if (spin >= LOG_PRIOR_LSA_COMBINE_SPIN_COUNT)
+	{
+	  prior_info->prior_lsa_mutex.lock ();
+	  break;
+	}
+      std::this_thread::yield ();
+    }
+
+  if (ATOMIC_LOAD (&request.is_linked))
+    {
+      /* linked by previous combiner */
+      prior_info->prior_lsa_mutex.unlock ();
+      return request.start_lsa;
+    }
+
+  /* the record is published and not linked yet, so it is in the list */
+  combine_list = prior_info->combine_list_header.exchange (NULL);
+  assert (combine_list != NULL);
+
+  /* restore publish order */
+  reversed = NULL;
+  while (combine_list != NULL)
+    {
+      next = combine_list->next;
+      combine_list->next = reversed;
+      reversed = combine_list;
+      combine_list = next;
+    }
+
+  for (combine_list = reversed; combine_list != NULL; combine_list = next)
+    {
+      next = combine_list->next;
+
+      combine_list->start_lsa = prior_lsa_link_record (thread_p, combine_list->node, combine_list->tdes);
+      if (combine_list != &request)
+	{
+	  count_combined++;
+	}
+
+      /* the request lives on the stack of its owner, which may return right after */
+      ATOMIC_STORE (&combine_list->is_linked, 1);
+    }
+  assert (request.is_linked);
+
+  prior_info->prior_lsa_mutex.unlock ();
+
+  if (count_combined > 0)
+    {
+      perfmon_add_stat (thread_p, PSTAT_PRIOR_LSA_COMBINED_RECORDS, count_combined);
+    }
+
+  return request.start_lsa;
+}
+#endif /* SERVER_MODE */
+
+/*
+ * prior_lsa_next_record_internal -
+ *
+ * return: start lsa of log record
+ *
+ *   node(in/out):
+ *   tdes(in/out):
+ *   with_lock(in):
+ */
+static LOG_LSA
+prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes, int with_lock)
+{
+  LOG_LSA start_lsa;
+
   if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
     {
+#if defined (SERVER_MODE)
+      start_lsa = prior_lsa_combine_and_link_record (thread_p, node, tdes);
+#else /* !SERVER_MODE */
+      log_Gl.prior_info.prior_lsa_mutex.lock ();
+      start_lsa = prior_lsa_link_record (thread_p, node, tdes);
       log_Gl.prior_info.prior_lsa_mutex.unlock ();
+#endif /* !SERVER_MODE */
+    }
+  else
+    {
+      start_lsa = prior_lsa_link_record (thread_p, node, tdes);
+    }
 
+  if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
+    {
       if (log_Gl.prior_info.list_size >= (INT64) logpb_get_memsize ())
 	{
 	  perfmon_inc_stat (thread_p, PSTAT_PRIOR_LSA_LIST_MAXED);
@@ -108,6 +108,20 @@ struct log_prior_node
   LOG_PRIOR_NODE *next;
 };
 
+/* a log record waiting to be linked to prior list by whoever holds prior_lsa_mutex next */
+typedef struct log_prior_combine_request LOG_PRIOR_COMBINE_REQUEST;
+struct log_prior_combine_request
+{
+  LOG_PRIOR_NODE *node;
+  log_tdes *tdes;
+  LOG_LSA start_lsa;		/* output: start lsa of log record */
+  volatile int is_linked;	/* set when the record is linked */
+  LOG_PRIOR_COMBINE_REQUEST *next;
+};
+
+/* how many times an appender checks if its record was linked by another thread before blocking on prior_lsa_mutex */
+const int LOG_PRIOR_LSA_COMBINE_SPIN_COUNT = 64;
+
 typedef struct log_prior_lsa_info LOG_PRIOR_LSA_INFO;
 struct log_prior_lsa_info
 {
@@ -125,6 +139,9 @@ struct log_prior_lsa_info
 
   std::mutex prior_lsa_mutex;
 
+  /* records published by concurrent appenders, latest first */
+  std::atomic<LOG_PRIOR_COMBINE_REQUEST *> combine_list_header;
+
   log_prior_lsa_info ();
 };
 
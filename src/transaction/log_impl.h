@@ -335,16 +335,43 @@ struct log_flush_info
 #endif				/* SERVER_MODE */
 };
 
+/* a committer waiting for its log to be flushed */
+typedef struct log_group_commit_waiter LOG_GROUP_COMMIT_WAITER;
+struct log_group_commit_waiter
+{
+  LOG_LSA flush_lsa;		/* log must be flushed up to this lsa */
+  pthread_cond_t wakeup_cond;	/* signaled by log flush once flush_lsa is flushed */
+  bool is_flushed;
+  LOG_GROUP_COMMIT_WAITER *next;
+};
+
 typedef struct log_group_commit_info LOG_GROUP_COMMIT_INFO;
 struct log_group_commit_info
 {
-  /* group commit waiters count */
   pthread_mutex_t gc_mutex;
-  pthread_cond_t gc_cond;
+  /* committers waiting for log flush; each is woken when its own lsa is flushed */
+  LOG_GROUP_COMMIT_WAITER *waiters;
+
+  /* adaptive group commit */
+  INT64 last_commit_usec;	/* time of last group commit request */
+  double avg_commit_gap_usec;	/* moving average of time between group commit requests */
+  double avg_flush_usec;	/* moving average of log flush duration */
 };
 
 #define LOG_GROUP_COMMIT_INFO_INITIALIZER \
-  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+  { PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0.0, 0.0 }
+
+/* read ahead state of a reader going through the log in one direction */
+typedef struct log_read_ahead LOG_READ_AHEAD;
+struct log_read_ahead
+{
+  LOG_PAGEID start_pageid;	/* page where the current read ahead window started */
+  LOG_PAGEID next_pageid;	/* first page not requested yet, in reading direction */
+  bool is_backward;		/* reader goes from newer to older log pages */
+};
+
+#define LOG_READ_AHEAD_INITIALIZER { NULL_PAGEID, NULL_PAGEID, false }
+#define LOG_READ_AHEAD_BACKWARD_INITIALIZER { NULL_PAGEID, NULL_PAGEID, true }
 
 
 
@@ -978,6 +1005,8 @@ extern int logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid
 				      LOG_PAGE * log_pgptr);
 extern int logpb_read_page_from_active_log (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, int num_pages,
 					    bool decrypt_needed, LOG_PAGE * log_pgptr);
+extern void logpb_prefetch_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOG_PAGEID last_pageid);
+extern void logpb_read_ahead (THREAD_ENTRY * thread_p, LOG_READ_AHEAD * read_ahead, LOG_PAGEID pageid);
 extern int logpb_write_page_to_disk (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr, LOG_PAGEID logical_pageid);
 extern int logpb_fetch_header_from_active_log (THREAD_ENTRY * thread_p, const char *db_fullname,
 					       const char *logpath, const char *prefix_logname, LOG_HEADER * hdr,
@@ -991,6 +1020,11 @@ extern int logpb_fetch_start_append_page (THREAD_ENTRY * thread_p);
 extern LOG_PAGE *logpb_fetch_start_append_page_new (THREAD_ENTRY * thread_p);
 extern void logpb_flush_pages_direct (THREAD_ENTRY * thread_p);
 extern void logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa);
+#if defined (SERVER_MODE)
+extern INT64 logpb_group_commit_get_time_usec (void);
+extern bool logpb_group_commit_wakeup_flushed (INT64 flush_usec);
+extern INT64 logpb_group_commit_get_window_usec (void);
+#endif /* SERVER_MODE */
 extern void logpb_force_flush_pages (THREAD_ENTRY * thread_p);
 extern void logpb_force_flush_header_and_pages (THREAD_ENTRY * thread_p);
 extern void logpb_invalid_all_append_pages (THREAD_ENTRY * thread_p);
@@ -1084,6 +1118,7 @@ extern void logtb_clear_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 extern void logtb_finalize_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 extern int logtb_get_new_tran_id (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 extern int logtb_find_tran_index (THREAD_ENTRY * thread_p, TRANID trid);
+extern int logtb_find_tran_index_by_mvccid (THREAD_ENTRY * thread_p, MVCCID mvccid);
 #if defined (ENABLE_UNUSED_FUNCTION)
 extern int logtb_find_tran_index_host_pid (THREAD_ENTRY * thread_p, const char *host_name, int process_id);
 #endif
@@ -10058,6 +10058,15 @@ log_get_log_group_commit_interval (bool & is_timed_wait, cubthread::delta_time &
   else
     {
       period = std::chrono::milliseconds (log_group_commit_interval_msec);
+
+#if defined (SERVER_MODE)
+      // adaptive group commit waits about one log flush duration, never longer than the configured interval
+      INT64 window_usec = logpb_group_commit_get_window_usec ();
+      if (window_usec > 0 && window_usec < (INT64) log_group_commit_interval_msec * 1000)
+	{
+	  period = std::chrono::microseconds (window_usec);
+	}
+#endif /* SERVER_MODE */
     }
 }
 
@@ -10377,6 +10386,9 @@ log_flush_execute (cubthread::entry & thread_ref)
   // refresh log trace flush time
   thread_ref.event_stats.trace_log_flush_time = prm_get_integer_value (PRM_ID_LOG_TRACE_FLUSH_TIME_MSECS);
 
+  INT64 flush_start_usec = logpb_group_commit_get_time_usec ();
+  bool has_waiters;
+
   LOG_CS_ENTER (&thread_ref);
   logpb_flush_pages_direct (&thread_ref);
   LOG_CS_EXIT (&thread_ref);
@@ -10384,8 +10396,9 @@ log_flush_execute (cubthread::entry & thread_ref)
   log_Stat.gc_flush_count++;
 
   pthread_mutex_lock (&log_Gl.group_commit_info.gc_mutex);
-  pthread_cond_broadcast (&log_Gl.group_commit_info.gc_cond);
-  log_Flush_has_been_requested = false;
+  has_waiters = logpb_group_commit_wakeup_flushed (logpb_group_commit_get_time_usec () - flush_start_usec);
+  // with adaptive group commit, committers that arrived during the flush are the next group; flush them right away
+  log_Flush_has_been_requested = has_waiters && prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE);
   pthread_mutex_unlock (&log_Gl.group_commit_info.gc_mutex);
 }
 #endif /* SERVER_MODE */
@@ -11054,6 +11067,7 @@ cdc_loginfo_producer_execute (cubthread::entry & thread_ref)
   LOG_LSA nxio_lsa = LSA_INITIALIZER;
 
   CDC_LOGINFO_ENTRY log_info_entry;
+  LOG_READ_AHEAD read_ahead = LOG_READ_AHEAD_INITIALIZER;
 
   THREAD_ENTRY *thread_p = &thread_ref;
   thread_p->is_cdc_daemon = true;
@@ -11127,6 +11141,7 @@ cdc_loginfo_producer_execute (cubthread::entry & thread_ref)
       LSA_COPY (&cur_log_rec_lsa, &cdc_Gl.producer.next_extraction_lsa);
       LSA_COPY (&process_lsa, &cur_log_rec_lsa);
 
+      logpb_read_ahead (thread_p, &read_ahead, process_lsa.pageid);
       error = cdc_log_extract (thread_p, &process_lsa, &log_info_entry);
       if (!(error == NO_ERROR || error == ER_CDC_LOGINFO_ENTRY_GENERATED))
 	{
@@ -106,6 +106,9 @@
 #include "crypt_opfunc.h"
 #include "object_representation.h"
 #include "flashback.h"
+
+#include <chrono>
+
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
 
@@ -155,6 +158,11 @@ static int rv;
 
 #define ARV_PAGE_INFO_TABLE_SIZE    256
 
+/* exponentially weighted moving average of group commit measurements; new sample weighs 1/8 */
+#define LOGPB_GROUP_COMMIT_UPDATE_AVERAGE(avg, sample) \
+  ((avg) = (avg) + ((double) (sample) - (avg)) / 8)
+#define LOGPB_GROUP_COMMIT_MIN_WINDOW_USEC  100
+
 #define LOG_LAST_APPEND_PTR() ((char *) log_Gl.append.log_pgptr->area + LOGAREA_SIZE)
 
 #define LOG_APPEND_ALIGN(thread_p, current_setdirty) \
@@ -241,6 +249,7 @@ struct log_pb_global_data
 {
   LOG_BUFFER *buffers;		/* Log buffer pool */
   LOG_PAGE *pages_area;
+  OS_LARGE_PAGE_TYPE pages_area_page_type;	/* pages backing pages_area */
   LOG_BUFFER header_buffer;
   LOG_PAGE *header_page;
   int num_buffers;		/* Number of log buffers */
@@ -293,11 +302,16 @@ static bool logpb_is_any_dirty (THREAD_ENTRY * thread_p);
 static bool logpb_is_any_fix (THREAD_ENTRY * thread_p);
 #endif /* CUBRID_DEBUG */
 static void logpb_dump_information (FILE * out_fp);
+#if defined (SERVER_MODE)
+static void logpb_group_commit_record_wait (THREAD_ENTRY * thread_p, INT64 wait_usec);
+#endif /* SERVER_MODE */
 static void logpb_dump_to_flush_page (FILE * out_fp);
 static void logpb_dump_pages (FILE * out_fp);
 static void logpb_initialize_backup_info (LOG_HEADER * loghdr);
 static LOG_PAGE **logpb_writev_append_pages (THREAD_ENTRY * thread_p, LOG_PAGE ** to_flush, DKNPAGES npages);
 static int logpb_get_guess_archive_num (THREAD_ENTRY * thread_p, LOG_PAGEID pageid);
+static int logpb_prefetch_log_segment (THREAD_ENTRY * thread_p, LOG_PAGEID anchor_pageid, LOG_PAGEID * first_pageid,
+				       LOG_PAGEID * last_pageid);
 static void logpb_set_unavailable_archive (THREAD_ENTRY * thread_p, int arv_num);
 static void logpb_dismount_log_archive (THREAD_ENTRY * thread_p);
 static bool logpb_is_archive_available (THREAD_ENTRY * thread_p, int arv_num);
@@ -329,6 +343,8 @@ static void logpb_dump_log_header (FILE * outfp);
 static void logpb_dump_parameter (FILE * outfp);
 static void logpb_dump_runtime (FILE * outfp);
 static void logpb_initialize_log_buffer (LOG_BUFFER * log_buffer_p, LOG_PAGE * log_pg);
+static LOG_PAGE *logpb_alloc_pages_area (size_t size);
+static void logpb_free_pages_area (void);
 
 static int logpb_check_stop_at_time (FILEIO_BACKUP_SESSION * session, time_t stop_at, time_t backup_time);
 static void logpb_write_toflush_pages_to_archive (THREAD_ENTRY * thread_p);
@@ -407,6 +423,60 @@ logpb_get_log_buffer (LOG_PAGE * log_pg)
   return &log_Pb.buffers[index];
 }
 
+/*
+ * logpb_alloc_pages_area - allocate the memory of log buffer pages
+ *
+ * return: memory or NULL
+ *
+ *   size(in): size of all log buffer pages
+ *
+ * NOTE: With use_huge_pages, the pages are backed by huge pages when the
+ *       system can provide them. What was obtained is reported to the
+ *       error log.
+ */
+static LOG_PAGE *
+logpb_alloc_pages_area (size_t size)
+{
+  LOG_PAGE *pages_area = NULL;
+
+  log_Pb.pages_area_page_type = OS_LARGE_PAGE_NONE;
+
+  if (prm_get_bool_value (PRM_ID_USE_HUGE_PAGES))
+    {
+      pages_area = (LOG_PAGE *) os_alloc_large_pages (size, &log_Pb.pages_area_page_type);
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_PB_TABLE_PAGE_TYPE, 3, "Log buffer pages", (long long) size,
+	      os_large_page_type_name (pages_area != NULL ? log_Pb.pages_area_page_type : OS_LARGE_PAGE_NONE));
+    }
+  if (pages_area == NULL)
+    {
+      log_Pb.pages_area_page_type = OS_LARGE_PAGE_NONE;
+      pages_area = (LOG_PAGE *) malloc (size);
+    }
+
+  return pages_area;
+}
+
+/*
+ * logpb_free_pages_area - free the memory of log buffer pages
+ *
+ * return: nothing
+ */
+static void
+logpb_free_pages_area (void)
+{
+  if (log_Pb.pages_area_page_type == OS_LARGE_PAGE_NONE)
+    {
+      free_and_init (log_Pb.pages_area);
+    }
+  else
+    {
+      os_free_large_pages (log_Pb.pages_area, (size_t) log_Pb.num_buffers * LOG_PAGESIZE,
+			   log_Pb.pages_area_page_type);
+      log_Pb.pages_area = NULL;
+      log_Pb.pages_area_page_type = OS_LARGE_PAGE_NONE;
+    }
+}
+
 /*
  * logpb_initialize_log_buffer -
  *
@@ -583,7 +653,7 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
     }
 
   size = ((size_t) log_Pb.num_buffers * (LOG_PAGESIZE));
-  log_Pb.pages_area = (LOG_PAGE *) malloc (size);
+  log_Pb.pages_area = logpb_alloc_pages_area (size);
   if (log_Pb.pages_area == NULL)
     {
       free_and_init (log_Pb.buffers);
@@ -604,7 +674,7 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
   if (log_Pb.header_page == NULL)
     {
       free_and_init (log_Pb.buffers);
-      free_and_init (log_Pb.pages_area);
+      logpb_free_pages_area ();
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
@@ -631,8 +701,11 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
   logpb_Initialized = true;
   pthread_mutex_init (&log_Gl.chkpt_lsa_lock, NULL);
 
-  pthread_cond_init (&group_commit_info->gc_cond, NULL);
   pthread_mutex_init (&group_commit_info->gc_mutex, NULL);
+  group_commit_info->waiters = NULL;
+  group_commit_info->last_commit_usec = 0;
+  group_commit_info->avg_commit_gap_usec = 0.0;
+  group_commit_info->avg_flush_usec = 0.0;
 
   pthread_mutex_init (&writer_info->wr_list_mutex, NULL);
 
@@ -693,7 +766,7 @@ logpb_finalize_pool (THREAD_ENTRY * thread_p)
 #endif /* CUBRID_DEBUG */
 
   free_and_init (log_Pb.buffers);
-  free_and_init (log_Pb.pages_area);
+  logpb_free_pages_area ();
   free_and_init (log_Pb.header_page);
   log_Pb.num_buffers = 0;
   logpb_Initialized = false;
@@ -701,8 +774,8 @@ logpb_finalize_pool (THREAD_ENTRY * thread_p)
 
   pthread_mutex_destroy (&log_Gl.chkpt_lsa_lock);
 
+  assert (log_Gl.group_commit_info.waiters == NULL);
   pthread_mutex_destroy (&log_Gl.group_commit_info.gc_mutex);
-  pthread_cond_destroy (&log_Gl.group_commit_info.gc_cond);
 
   logpb_finalize_writer_info ();
 
@@ -2246,6 +2319,167 @@ logpb_read_page_from_active_log (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, int
   return num_pages;
 }
 
+/*
+ * logpb_prefetch_log_segment - ask the operating system to read ahead the pages of a range stored next to a page
+ *
+ * return: number of pages read ahead
+ *
+ *   anchor_pageid(in): page of the range, either its first or its last page
+ *   first_pageid(in/out): first logical page of the range; set to the first page read ahead
+ *   last_pageid(in/out): last logical page of the range; set to the last page read ahead
+ *
+ * NOTE: Only the pages of the range stored contiguously with the anchor page are read ahead: the pages of the same
+ *       archive, or of the same pass over the circular active log. Pages of other archives are not read ahead,
+ *       since mounting an archive here would disturb the reader that has it mounted.
+ */
+static int
+logpb_prefetch_log_segment (THREAD_ENTRY * thread_p, LOG_PAGEID anchor_pageid, LOG_PAGEID * first_pageid,
+			    LOG_PAGEID * last_pageid)
+{
+  int num_pages = 0;
+#if _POSIX_C_SOURCE >= 200112L
+  LOG_PHY_PAGEID phy_start_pageid, phy_anchor_pageid;
+  LOG_PAGEID arv_last_pageid;
+
+  assert (*first_pageid <= anchor_pageid && anchor_pageid <= *last_pageid);
+
+  if (logpb_is_page_in_archive (anchor_pageid))
+    {
+      LOG_ARCHIVE_CS_ENTER_READ_MODE (thread_p);
+      arv_last_pageid = log_Gl.archive.hdr.fpageid + log_Gl.archive.hdr.npages - 1;
+      if (log_Gl.archive.vdes != NULL_VOLDES && log_Gl.archive.hdr.fpageid <= anchor_pageid
+	  && anchor_pageid <= arv_last_pageid)
+	{
+	  *first_pageid = MAX (*first_pageid, log_Gl.archive.hdr.fpageid);
+	  *last_pageid = MIN (*last_pageid, arv_last_pageid);
+	  phy_start_pageid = (LOG_PHY_PAGEID) (*first_pageid - log_Gl.archive.hdr.fpageid + 1);
+	  num_pages = (int) (*last_pageid - *first_pageid + 1);
+
+	  (void) posix_fadvise (log_Gl.archive.vdes, (off_t) phy_start_pageid * LOG_PAGESIZE,
+				(off_t) num_pages * LOG_PAGESIZE, POSIX_FADV_WILLNEED);
+	}
+      LOG_ARCHIVE_CS_EXIT (thread_p);
+
+      return num_pages;
+    }
+
+  if (log_Gl.append.vdes == NULL_VOLDES)
+    {
+      return 0;
+    }
+
+  /* the active log is circular; pages are contiguous up to the end of the file and from its start */
+  phy_anchor_pageid = logpb_to_physical_pageid (anchor_pageid);
+  *first_pageid = MAX (*first_pageid, MAX (anchor_pageid - (phy_anchor_pageid - 1), LOGPB_NEXT_ARCHIVE_PAGE_ID));
+  *last_pageid = MIN (*last_pageid, anchor_pageid + (LOGPB_ACTIVE_NPAGES - phy_anchor_pageid));
+  phy_start_pageid = logpb_to_physical_pageid (*first_pageid);
+  num_pages = (int) (*last_pageid - *first_pageid + 1);
+
+  (void) posix_fadvise (log_Gl.append.vdes, (off_t) phy_start_pageid * LOG_PAGESIZE, (off_t) num_pages * LOG_PAGESIZE,
+			POSIX_FADV_WILLNEED);
+#endif /* _POSIX_C_SOURCE >= 200112L */
+
+  return num_pages;
+}
+
+/*
+ * logpb_prefetch_log_pages - ask the operating system to read ahead a range of log pages
+ *
+ * return: nothing
+ *
+ *   first_pageid(in): first logical page to read ahead
+ *   last_pageid(in): last logical page to read ahead
+ *
+ * NOTE: The read is asynchronous and done by the operating system in large requests; a later logpb_fetch_page of
+ *       these pages finds them in the file system cache instead of waiting for the disk.
+ *       Nothing is read ahead when log_read_ahead_pages is 0. Pages of the range beyond the archive or the end of
+ *       the active log where it starts are left to a later call.
+ */
+void
+logpb_prefetch_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOG_PAGEID last_pageid)
+{
+  if (prm_get_integer_value (PRM_ID_LOG_READ_AHEAD_PAGES) <= 0 || first_pageid == NULL_PAGEID
+      || first_pageid > last_pageid)
+    {
+      return;
+    }
+
+  (void) logpb_prefetch_log_segment (thread_p, first_pageid, &first_pageid, &last_pageid);
+}
+
+/*
+ * logpb_read_ahead - keep log pages read ahead of a reader that goes through the log in one direction
+ *
+ * return: nothing
+ *
+ *   read_ahead(in/out): read ahead state of the reader
+ *   pageid(in): log page the reader is about to fetch
+ *
+ * NOTE: A new window of log_read_ahead_pages pages is requested once the reader is half way through the pages
+ *       requested before, so that the disk keeps streaming while the reader decodes. A reader that jumps against
+ *       its direction or past the requested pages restarts the window. A window that crosses the end of an archive
+ *       or of the active log is cut there; the rest is requested by the next call.
+ */
+void
+logpb_read_ahead (THREAD_ENTRY * thread_p, LOG_READ_AHEAD * read_ahead, LOG_PAGEID pageid)
+{
+  int window_pages = prm_get_integer_value (PRM_ID_LOG_READ_AHEAD_PAGES);
+  LOG_PAGEID first_pageid, last_pageid;
+  bool is_restart;
+  int num_pages;
+
+  if (window_pages <= 0 || pageid == NULL_PAGEID)
+    {
+      return;
+    }
+
+  if (!read_ahead->is_backward)
+    {
+      is_restart = (read_ahead->next_pageid == NULL_PAGEID || pageid < read_ahead->start_pageid
+		    || pageid >= read_ahead->next_pageid);
+      if (!is_restart && pageid + window_pages / 2 < read_ahead->next_pageid)
+	{
+	  /* still enough pages requested ahead */
+	  return;
+	}
+
+      first_pageid = is_restart ? pageid + 1 : read_ahead->next_pageid;
+      last_pageid = pageid + window_pages;
+      if (first_pageid > last_pageid)
+	{
+	  return;
+	}
+
+      num_pages = logpb_prefetch_log_segment (thread_p, first_pageid, &first_pageid, &last_pageid);
+      read_ahead->next_pageid = (num_pages > 0) ? last_pageid + 1 : first_pageid;
+    }
+  else
+    {
+      is_restart = (read_ahead->next_pageid == NULL_PAGEID || pageid > read_ahead->start_pageid
+		    || pageid <= read_ahead->next_pageid);
+      if (!is_restart && pageid - window_pages / 2 > read_ahead->next_pageid)
+	{
+	  /* still enough pages requested ahead */
+	  return;
+	}
+
+      first_pageid = MAX (pageid - window_pages, 0);
+      last_pageid = is_restart ? pageid - 1 : read_ahead->next_pageid;
+      if (first_pageid > last_pageid)
+	{
+	  return;
+	}
+
+      num_pages = logpb_prefetch_log_segment (thread_p, last_pageid, &first_pageid, &last_pageid);
+      read_ahead->next_pageid = (num_pages > 0) ? first_pageid - 1 : last_pageid;
+    }
+
+  if (is_restart)
+    {
+      read_ahead->start_pageid = pageid;
+    }
+}
+
 /*
  * logpb_write_page_to_disk - writes and syncs a log page to disk
  *
@@ -3976,7 +4210,6 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   logpb_flush_pages_direct (thread_p);
   LOG_CS_EXIT (thread_p);
 #else /* SERVER_MODE */
-  int rv;
   struct timeval start_time = { 0, 0 };
   struct timeval tmp_timeval = { 0, 0 };
   struct timespec to = { 0, 0 };
@@ -3985,6 +4218,9 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   bool async_commit, group_commit;
   LOG_LSA nxio_lsa;
   LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_GROUP_COMMIT_WAITER waiter;
+  LOG_GROUP_COMMIT_WAITER **prev_link;
+  INT64 wait_start_usec, now_usec;
 
   assert (flush_lsa != NULL && !LSA_ISNULL (flush_lsa));
 
@@ -4043,47 +4279,210 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	}
     }
 
+  if (group_commit == true && prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE))
+    {
+      pthread_mutex_lock (&group_commit_info->gc_mutex);
+      now_usec = logpb_group_commit_get_time_usec ();
+      if (group_commit_info->last_commit_usec > 0)
+	{
+	  LOGPB_GROUP_COMMIT_UPDATE_AVERAGE (group_commit_info->avg_commit_gap_usec,
+					     now_usec - group_commit_info->last_commit_usec);
+	}
+      group_commit_info->last_commit_usec = now_usec;
+
+      /* nobody else is expected to commit during a log flush; waiting for company only adds latency */
+      if (group_commit_info->avg_commit_gap_usec >= group_commit_info->avg_flush_usec)
+	{
+	  need_wakeup_LFT = true;
+	}
+      pthread_mutex_unlock (&group_commit_info->gc_mutex);
+    }
+
   if (need_wakeup_LFT == true && need_wait == false)
     {
       log_wakeup_log_flush_daemon ();
     }
   else if (need_wait == true)
     {
-      nxio_lsa = log_Gl.append.get_nxio_lsa ();
+      wait_start_usec = logpb_group_commit_get_time_usec ();
 
       if (need_wakeup_LFT == false && pgbuf_has_perm_pages_fixed (thread_p))
 	{
 	  need_wakeup_LFT = true;
 	}
 
-      while (LSA_LT (&nxio_lsa, flush_lsa))
+      pthread_mutex_lock (&group_commit_info->gc_mutex);
+      nxio_lsa = log_Gl.append.get_nxio_lsa ();
+      if (LSA_LT (&nxio_lsa, flush_lsa))
 	{
-	  gettimeofday (&start_time, NULL);
-	  (void) timeval_add_msec (&tmp_timeval, &start_time, max_wait_time_in_msec);
-	  (void) timeval_to_timespec (&to, &tmp_timeval);
+	  /* register to be woken when our log is flushed */
+	  LSA_COPY (&waiter.flush_lsa, flush_lsa);
+	  pthread_cond_init (&waiter.wakeup_cond, NULL);
+	  waiter.is_flushed = false;
+	  waiter.next = group_commit_info->waiters;
+	  group_commit_info->waiters = &waiter;
 
-	  rv = pthread_mutex_lock (&group_commit_info->gc_mutex);
-	  nxio_lsa = log_Gl.append.get_nxio_lsa ();
-	  if (LSA_GE (&nxio_lsa, flush_lsa))
+	  while (!waiter.is_flushed)
 	    {
-	      pthread_mutex_unlock (&group_commit_info->gc_mutex);
-	      break;
-	    }
+	      if (need_wakeup_LFT == true)
+		{
+		  log_wakeup_log_flush_daemon ();
+		}
 
-	  if (need_wakeup_LFT == true)
-	    {
-	      log_wakeup_log_flush_daemon ();
+	      gettimeofday (&start_time, NULL);
+	      (void) timeval_add_msec (&tmp_timeval, &start_time, max_wait_time_in_msec);
+	      (void) timeval_to_timespec (&to, &tmp_timeval);
+	      (void) pthread_cond_timedwait (&waiter.wakeup_cond, &group_commit_info->gc_mutex, &to);
+
+	      if (!waiter.is_flushed)
+		{
+		  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+		  if (LSA_GE (&nxio_lsa, flush_lsa))
+		    {
+		      /* flushed by someone else; remove self from waiters */
+		      for (prev_link = &group_commit_info->waiters; *prev_link != &waiter;
+			   prev_link = &(*prev_link)->next)
+			{
+			  assert (*prev_link != NULL);
+			}
+		      *prev_link = waiter.next;
+		      waiter.is_flushed = true;
+		    }
+		}
+	      need_wakeup_LFT = true;
 	    }
-	  (void) pthread_cond_timedwait (&group_commit_info->gc_cond, &group_commit_info->gc_mutex, &to);
 	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
-
-	  need_wakeup_LFT = true;
-	  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+	  pthread_cond_destroy (&waiter.wakeup_cond);
 	}
+      else
+	{
+	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+	}
+
+      logpb_group_commit_record_wait (thread_p, logpb_group_commit_get_time_usec () - wait_start_usec);
     }
 #endif /* SERVER_MODE */
 }
 
+#if defined (SERVER_MODE)
+/*
+ * logpb_group_commit_get_time_usec - current time for group commit measurements
+ *
+ * return: monotonic time in microseconds
+ */
+INT64
+logpb_group_commit_get_time_usec (void)
+{
+  // *INDENT-OFF*
+  return std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+  // *INDENT-ON*
+}
+
+/*
+ * logpb_group_commit_record_wait - publish the time a committer waited for its log flush
+ *
+ * return: nothing
+ *
+ *   wait_usec(in): wait time in microseconds
+ */
+static void
+logpb_group_commit_record_wait (THREAD_ENTRY * thread_p, INT64 wait_usec)
+{
+  PERF_STAT_ID bucket;
+
+  perfmon_time_stat (thread_p, PSTAT_LOG_COMMIT_WAIT_TIME_COUNTERS, (UINT64) wait_usec);
+
+  if (wait_usec < 100)
+    {
+      bucket = PSTAT_LOG_COMMIT_WAIT_UNDER_100USEC;
+    }
+  else if (wait_usec < 1000)
+    {
+      bucket = PSTAT_LOG_COMMIT_WAIT_UNDER_1MSEC;
+    }
+  else if (wait_usec < 10 * 1000)
+    {
+      bucket = PSTAT_LOG_COMMIT_WAIT_UNDER_10MSEC;
+    }
+  else if (wait_usec < 100 * 1000)
+    {
+      bucket = PSTAT_LOG_COMMIT_WAIT_UNDER_100MSEC;
+    }
+  else
+    {
+      bucket = PSTAT_LOG_COMMIT_WAIT_OVER_100MSEC;
+    }
+  perfmon_inc_stat (thread_p, bucket);
+}
+
+/*
+ * logpb_group_commit_wakeup_flushed - wake the committers whose log was flushed
+ *
+ * return: true if some committers still wait for log that is not flushed yet
+ *
+ *   flush_usec(in): duration of log flush that just ended
+ *
+ * NOTE: The caller must hold gc_mutex.
+ */
+bool
+logpb_group_commit_wakeup_flushed (INT64 flush_usec)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_GROUP_COMMIT_WAITER **prev_link;
+  LOG_GROUP_COMMIT_WAITER *waiter;
+  LOG_LSA nxio_lsa;
+
+  LOGPB_GROUP_COMMIT_UPDATE_AVERAGE (group_commit_info->avg_flush_usec, flush_usec);
+
+  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+
+  prev_link = &group_commit_info->waiters;
+  while (*prev_link != NULL)
+    {
+      waiter = *prev_link;
+      if (LSA_GE (&nxio_lsa, &waiter->flush_lsa))
+	{
+	  /* the waiter lives on the stack of committer; it may be gone once signaled */
+	  *prev_link = waiter->next;
+	  waiter->is_flushed = true;
+	  pthread_cond_signal (&waiter->wakeup_cond);
+	}
+      else
+	{
+	  prev_link = &waiter->next;
+	}
+    }
+
+  return group_commit_info->waiters != NULL;
+}
+
+/*
+ * logpb_group_commit_get_window_usec - how long log flush daemon waits to group commits
+ *
+ * return: window in microseconds; 0 to use log_group_commit_interval_msecs as is
+ *
+ * NOTE: With adaptive group commit, the window follows the observed log flush duration, bounded by
+ *       log_group_commit_interval_msecs. Commits arriving while a flush runs are flushed by the next one.
+ */
+INT64
+logpb_group_commit_get_window_usec (void)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  INT64 window_usec;
+
+  if (!prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE))
+    {
+      return 0;
+    }
+
+  pthread_mutex_lock (&group_commit_info->gc_mutex);
+  window_usec = (INT64) group_commit_info->avg_flush_usec;
+  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
+  return MAX (window_usec, LOGPB_GROUP_COMMIT_MIN_WINDOW_USEC);
+}
+#endif /* SERVER_MODE */
+
 void
 logpb_force_flush_pages (THREAD_ENTRY * thread_p)
 {
@@ -6887,7 +7286,9 @@ logpb_checkpoint (THREAD_ENTRY * thread_p)
   LOG_LSA chkpt_lsa;		/* copy of log_Gl.hdr.chkpt_lsa */
   LOG_LSA chkpt_redo_lsa;	/* copy of log_Gl.chkpt_redo_lsa */
   LOG_LSA newchkpt_lsa;		/* New address of the checkpoint record */
+  LOG_LSA flush_upto_lsa;	/* Dirty pages up to this LSA are flushed */
   LOG_LSA smallest_lsa;
+  int max_redo_npages;
   unsigned int nobj_locks;	/* Avg number of locks */
   char logarv_name[PATH_MAX];	/* Archive name */
   char logarv_name_first[PATH_MAX];	/* Archive name */
@@ -6981,8 +7382,18 @@ logpb_checkpoint (THREAD_ENTRY * thread_p)
       goto error_cannot_chkpt;
     }
 
+  /* With checkpoint_max_redo_npages, the checkpoint is incremental: only pages that would put the redo point more
+   * than that many log pages behind the new checkpoint are flushed. The others keep the redo point where it is. */
+  LSA_COPY (&flush_upto_lsa, &newchkpt_lsa);
+  max_redo_npages = prm_get_integer_value (PRM_ID_LOG_CHECKPOINT_MAX_REDO_NPAGES);
+  if (max_redo_npages > 0)
+    {
+      flush_upto_lsa.pageid = MAX (newchkpt_lsa.pageid - max_redo_npages, 0);
+      flush_upto_lsa.offset = 0;
+    }
+
   detailed_er_log ("logpb_checkpoint: call pgbuf_flush_checkpoint()\n");
-  if (pgbuf_flush_checkpoint (thread_p, &newchkpt_lsa, &chkpt_redo_lsa, &tmp_chkpt.redo_lsa, &flushed_page_cnt) !=
+  if (pgbuf_flush_checkpoint (thread_p, &flush_upto_lsa, &chkpt_redo_lsa, &tmp_chkpt.redo_lsa, &flushed_page_cnt) !=
       NO_ERROR)
     {
       goto error_cannot_chkpt;
@@ -6996,8 +7407,9 @@ logpb_checkpoint (THREAD_ENTRY * thread_p)
 
   LOG_CS_ENTER (thread_p);
 
-  if (LSA_ISNULL (&tmp_chkpt.redo_lsa))
+  if (LSA_ISNULL (&tmp_chkpt.redo_lsa) || LSA_GT (&tmp_chkpt.redo_lsa, &newchkpt_lsa))
     {
+      /* pages dirtied after the checkpoint started do not hold the redo point back */
       LSA_COPY (&tmp_chkpt.redo_lsa, &newchkpt_lsa);
     }
 
@@ -10374,6 +10786,13 @@ logpb_delete (THREAD_ENTRY * thread_p, VOLID num_perm_vols, const char *db_fulln
       fileio_unformat (thread_p, vol_fullname);
     }
 
+  /* Destroy page buffer warm-up file, if exists. */
+  fileio_make_pb_warmup_name (vol_fullname, db_fullname);
+  if (fileio_is_volume_exist (vol_fullname))
+    {
+      fileio_unformat (thread_p, vol_fullname);
+    }
+
   if (force_delete)
     {
       /*
@@ -68,6 +68,12 @@ class log_reader final
     }
 
     inline int set_lsa_and_fetch_page (const log_lsa &lsa, fetch_mode fetch_page_mode = fetch_mode::NORMAL);
+
+    /* have the next log pages read ahead while going forward through the log;
+     * only for readers that fetch pages mostly in increasing order
+     */
+    inline void enable_read_ahead ();
+
     inline const log_hdrpage &get_page_header () const;
 
     inline const log_page *get_page () const;
@@ -138,6 +144,8 @@ class log_reader final
                                                         * re-used in the future, we are keeping this variable and not removing it.*/
     log_page *m_page = nullptr;
     char m_area_buffer[IO_MAX_PAGE_SIZE + DOUBLE_ALIGNMENT];
+    bool m_is_read_ahead_enabled = false;
+    LOG_READ_AHEAD m_read_ahead = LOG_READ_AHEAD_INITIALIZER;
 };
 
 inline void LOG_READ_ALIGN (THREAD_ENTRY *thread_p, LOG_LSA *lsa, LOG_PAGE *log_pgptr,
@@ -172,6 +180,11 @@ int log_reader::set_lsa_and_fetch_page (const log_lsa &lsa, fetch_mode fetch_pag
   return NO_ERROR;
 }
 
+void log_reader::enable_read_ahead ()
+{
+  m_is_read_ahead_enabled = true;
+}
+
 const log_hdrpage &log_reader::get_page_header () const
 {
   return m_page->hdr;
@@ -268,6 +281,11 @@ int log_reader::skip (size_t size)
 
 int log_reader::fetch_page (THREAD_ENTRY *const thread_p)
 {
+  if (m_is_read_ahead_enabled)
+    {
+      logpb_read_ahead (thread_p, &m_read_ahead, m_lsa.pageid);
+    }
+
   if (logpb_fetch_page (thread_p, &m_lsa, m_cs_access, m_page) != NO_ERROR)
     {
       logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_reader::fetch_page");
@@ -43,6 +43,11 @@
 #include "slotted_page.h"
 #include "system_parameter.h"
 #include "thread_manager.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
 
@@ -106,7 +111,13 @@ static void log_recovery_finish_postpone (THREAD_ENTRY * thread_p, LOG_TDES * td
 static void log_recovery_finish_all_postpone (THREAD_ENTRY * thread_p);
 static void log_recovery_abort_atomic_sysop (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 static void log_recovery_abort_all_atomic_sysops (THREAD_ENTRY * thread_p);
-static void log_recovery_undo (THREAD_ENTRY * thread_p);
+static LOG_TDES *log_recovery_undo_log_record (THREAD_ENTRY * thread_p, LOG_TDES * tdes, int tran_index,
+					       LOG_LSA * log_lsa, LOG_PAGE * log_pgptr, LOG_ZIP * undo_unzip_ptr);
+#if defined (SERVER_MODE)
+static void log_recovery_undo_transaction (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
+static void log_recovery_undo_parallel (THREAD_ENTRY * thread_p);
+#endif /* SERVER_MODE */
+static void log_recovery_undo (THREAD_ENTRY * thread_p, const cublog::perf_stats & rcv_phase_perf_stat);
 static void log_recovery_notpartof_archives (THREAD_ENTRY * thread_p, int start_arv_num, const char *info_reason);
 static bool log_unformat_ahead_volumes (THREAD_ENTRY * thread_p, VOLID volid, VOLID * start_volid);
 static void log_recovery_notpartof_volumes (THREAD_ENTRY * thread_p);
@@ -816,12 +827,18 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_STARTED, 0);
 
+  // *INDENT-OFF*
+  cubperf::statset_definition rcv_phase_perf_stat_definition (cublog::perf_stats_phase_definition_init_list);
+  cublog::perf_stats rcv_phase_perf_stat (cublog::perf_stats_is_active_for_main (), rcv_phase_perf_stat_definition);
+  // *INDENT-ON*
+
   log_Gl.rcv_phase = LOG_RECOVERY_ANALYSIS_PHASE;
 
   log_recovery_analysis (thread_p, &rcv_lsa, &start_redolsa, &end_redo_lsa, ismedia_crash, stopat,
 			 &did_incom_recovery, &num_redo_log_records);
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_PHASE_FINISHED, 1, "ANALYSIS");
+  rcv_phase_perf_stat.time_and_increment (cublog::PERF_STAT_ID_PHASE_ANALYSIS);
 
   LSA_COPY (&log_Gl.chkpt_redo_lsa, &start_redolsa);
 
@@ -863,6 +880,7 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
   log_recovery_redo (thread_p, &start_redolsa, &end_redo_lsa);
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_PHASE_FINISHED, 1, "REDO");
+  rcv_phase_perf_stat.time_and_increment (cublog::PERF_STAT_ID_PHASE_REDO);
 
   boot_reset_db_parm (thread_p);
 
@@ -873,9 +891,11 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   /* ER_LOG_RECOVERY_REDO_STARTED logging is inside log_recovery_undo() */
 
-  log_recovery_undo (thread_p);
+  log_recovery_undo (thread_p, rcv_phase_perf_stat);
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_PHASE_FINISHED, 1, "UNDO");
+  rcv_phase_perf_stat.time_and_increment (cublog::PERF_STAT_ID_PHASE_UNDO);
+  rcv_phase_perf_stat.log ("Log recovery phases perf stats");
 
   boot_reset_db_parm (thread_p);
 
@@ -2611,6 +2631,7 @@ log_recovery_analysis (THREAD_ENTRY * thread_p, LOG_LSA * start_lsa, LOG_LSA * s
   int max_num_blocks = LOG_PAGESIZE / block_size;
   int last_checked_page_id = NULL_PAGEID;
   bool is_log_page_broken;
+  LOG_READ_AHEAD read_ahead = LOG_READ_AHEAD_INITIALIZER;
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
   null_block = PTR_ALIGN (null_buffer, MAX_ALIGNMENT);
@@ -2714,6 +2735,9 @@ log_recovery_analysis (THREAD_ENTRY * thread_p, LOG_LSA * start_lsa, LOG_LSA * s
 	    }
 	}
 
+      /* keep the operating system reading the next log pages while the records of this one are analyzed */
+      logpb_read_ahead (thread_p, &read_ahead, log_lsa.pageid);
+
       /* Check all log records in this phase */
       while (!LSA_ISNULL (&lsa) && lsa.pageid == log_lsa.pageid)
 	{
@@ -3243,6 +3267,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_LSA lsa;			/* LSA of log record to redo */
 
   log_rv_redo_context redo_context (*end_redo_lsa, log_reader::fetch_mode::NORMAL);
+  redo_context.m_reader.enable_read_ahead ();
 
   volatile TRANID tran_id;
   volatile LOG_RECTYPE log_rtype;
@@ -4403,18 +4428,20 @@ log_recovery_abort_atomic_sysop (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
 }
 
 /*
- * log_recovery_undo - SCAN BACKWARDS UNDOING DATA
+ * log_recovery_undo_log_record - undo one log record of a transaction being rolled back by recovery
  *
- * return: nothing
+ * return: the transaction descriptor, or NULL if the transaction was completed
  *
+ *   tdes(in/out): transaction descriptor
+ *   tran_index(in): transaction index
+ *   log_lsa(in/out): address of the log record; advanced while reading the record
+ *   log_pgptr(in/out): log page where the log record starts
+ *   undo_unzip_ptr(in): buffer to unzip undo data
  */
-static void
-log_recovery_undo (THREAD_ENTRY * thread_p)
+static LOG_TDES *
+log_recovery_undo_log_record (THREAD_ENTRY * thread_p, LOG_TDES * tdes, int tran_index, LOG_LSA * log_lsa,
+			      LOG_PAGE * log_pgptr, LOG_ZIP * undo_unzip_ptr)
 {
-  LOG_LSA max_undo_lsa = NULL_LSA;	/* LSA of log record to undo */
-  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_log_pgbuf;
-  LOG_PAGE *log_pgptr = NULL;	/* Log page pointer where LSA is located */
-  LOG_LSA log_lsa;
   LOG_RECORD_HEADER *log_rec = NULL;	/* Pointer to log record */
   LOG_REC_UNDOREDO *undoredo = NULL;	/* Undo_redo log record */
   LOG_REC_UNDO *undo = NULL;	/* Undo log record */
@@ -4427,16 +4454,493 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
   VPID rcv_vpid;		/* VPID of data to recover */
   LOG_LSA rcv_lsa;		/* Address of redo log record */
   LOG_LSA prev_tranlsa;		/* prev LSA of transaction */
+  int data_header_size = 0;
+  bool is_mvcc_op;
+  volatile TRANID tran_id;
+  volatile LOG_RECTYPE log_rtype;
+
+  log_rec = LOG_GET_LOG_RECORD_HEADER (log_pgptr, log_lsa);
+
+  tran_id = log_rec->trid;
+  log_rtype = log_rec->type;
+
+  LSA_COPY (&prev_tranlsa, &log_rec->prev_tranlsa);
+
+
+  LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
+
+  switch (log_rtype)
+    {
+    case LOG_MVCC_UNDOREDO_DATA:
+    case LOG_MVCC_DIFF_UNDOREDO_DATA:
+    case LOG_UNDOREDO_DATA:
+    case LOG_DIFF_UNDOREDO_DATA:
+      LSA_COPY (&rcv_lsa, log_lsa);
+      /*
+       * The transaction was active at the time of the crash. The
+       * transaction is unilaterally aborted by the system
+       */
+
+      if (log_rtype == LOG_MVCC_UNDOREDO_DATA || log_rtype == LOG_MVCC_DIFF_UNDOREDO_DATA)
+	{
+	  is_mvcc_op = true;
+	}
+      else
+	{
+	  is_mvcc_op = false;
+	}
+
+      /* Get the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+
+      if (is_mvcc_op)
+	{
+	  data_header_size = sizeof (LOG_REC_MVCC_UNDOREDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  mvcc_undoredo = (LOG_REC_MVCC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa->offset);
+
+	  /* Get undoredo info */
+	  undoredo = &mvcc_undoredo->undoredo;
+
+	  /* Save transaction MVCCID to recovery */
+	  rcv.mvcc_id = mvcc_undoredo->mvccid;
+	}
+      else
+	{
+	  data_header_size = sizeof (LOG_REC_UNDOREDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  undoredo = (LOG_REC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa->offset);
+
+	  rcv.mvcc_id = MVCCID_NULL;
+	}
+
+      rcvindex = undoredo->data.rcvindex;
+      rcv.length = undoredo->ulength;
+      rcv.offset = undoredo->data.offset;
+      rcv_vpid.volid = undoredo->data.volid;
+      rcv_vpid.pageid = undoredo->data.pageid;
+
+      LOG_READ_ADD_ALIGN (thread_p, data_header_size, log_lsa, log_pgptr);
+
+#if !defined(NDEBUG)
+      if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
+	{
+	  fprintf (stdout,
+		   "TRACE UNDOING[1]: LSA = %lld|%d, Rv_index = %s,\n"
+		   "      volid = %d, pageid = %d, offset = %d,\n", (long long int) rcv_lsa.pageid,
+		   (int) rcv_lsa.offset, rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid,
+		   rcv.offset);
+	  fflush (stdout);
+	}
+#endif /* !NDEBUG */
+
+      log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			  undo_unzip_ptr);
+      break;
+
+    case LOG_MVCC_UNDO_DATA:
+    case LOG_UNDO_DATA:
+      /* Does the record belong to a MVCC op? */
+      is_mvcc_op = log_rtype == LOG_MVCC_UNDO_DATA;
+
+      LSA_COPY (&rcv_lsa, log_lsa);
+      /*
+       * The transaction was active at the time of the crash. The
+       * transaction is unilaterally aborted by the system
+       */
+
+      /* Get the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+
+      if (is_mvcc_op)
+	{
+	  data_header_size = sizeof (LOG_REC_MVCC_UNDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  mvcc_undo = (LOG_REC_MVCC_UNDO *) ((char *) log_pgptr->area + log_lsa->offset);
+
+	  /* Get undo info */
+	  undo = &mvcc_undo->undo;
+
+	  /* Save transaction MVCCID to recovery */
+	  rcv.mvcc_id = mvcc_undo->mvccid;
+	}
+      else
+	{
+	  data_header_size = sizeof (LOG_REC_UNDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  undo = (LOG_REC_UNDO *) ((char *) log_pgptr->area + log_lsa->offset);
+
+	  rcv.mvcc_id = MVCCID_NULL;
+	}
+
+      rcvindex = undo->data.rcvindex;
+      rcv.length = undo->length;
+      rcv.offset = undo->data.offset;
+      rcv_vpid.volid = undo->data.volid;
+      rcv_vpid.pageid = undo->data.pageid;
+
+      LOG_READ_ADD_ALIGN (thread_p, data_header_size, log_lsa, log_pgptr);
+
+#if !defined(NDEBUG)
+      if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
+	{
+	  fprintf (stdout,
+		   "TRACE UNDOING[2]: LSA = %lld|%d, Rv_index = %s,\n"
+		   "      volid = %d, pageid = %d, offset = %hd,\n", LSA_AS_ARGS (&rcv_lsa),
+		   rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid, rcv.offset);
+	  fflush (stdout);
+	}
+#endif /* !NDEBUG */
+      log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			  undo_unzip_ptr);
+      break;
+
+    case LOG_REDO_DATA:
+    case LOG_MVCC_REDO_DATA:
+    case LOG_DBEXTERN_REDO_DATA:
+    case LOG_DUMMY_HEAD_POSTPONE:
+    case LOG_POSTPONE:
+    case LOG_SAVEPOINT:
+    case LOG_REPLICATION_DATA:
+    case LOG_REPLICATION_STATEMENT:
+    case LOG_DUMMY_HA_SERVER_STATE:
+    case LOG_DUMMY_OVF_RECORD:
+    case LOG_DUMMY_GENERIC:
+    case LOG_SUPPLEMENTAL_INFO:
+    case LOG_SYSOP_ATOMIC_START:
+      /* Not for UNDO ... */
+      /* Break switch to go to previous record */
+      break;
+
+    case LOG_COMPENSATE:
+      /* Only for REDO .. Go to next undo record Need to read the compensating record to set the next undo
+       * address. */
+
+      /* Get the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_COMPENSATE), log_lsa, log_pgptr);
+      compensate = (LOG_REC_COMPENSATE *) ((char *) log_pgptr->area + log_lsa->offset);
+      LSA_COPY (&prev_tranlsa, &compensate->undo_nxlsa);
+      break;
+
+    case LOG_SYSOP_END:
+      /*
+       * We found a system top operation that should be skipped from
+       * rollback
+       */
+
+      /* Read the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_SYSOP_END), log_lsa, log_pgptr);
+      sysop_end = ((LOG_REC_SYSOP_END *) ((char *) log_pgptr->area + log_lsa->offset));
+
+      if (sysop_end->type == LOG_SYSOP_END_LOGICAL_UNDO)
+	{
+	  /* execute undo */
+	  rcvindex = sysop_end->undo.data.rcvindex;
+	  rcv.length = sysop_end->undo.length;
+	  rcv.offset = sysop_end->undo.data.offset;
+	  rcv_vpid.volid = sysop_end->undo.data.volid;
+	  rcv_vpid.pageid = sysop_end->undo.data.pageid;
+	  rcv.mvcc_id = MVCCID_NULL;
+
+	  /* will jump to parent LSA. save it now before advancing to undo data */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
+	  LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
+
+	  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), log_lsa, log_pgptr);
+	  log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			      undo_unzip_ptr);
+	}
+      else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_MVCC_UNDO)
+	{
+	  /* execute undo */
+	  rcvindex = sysop_end->mvcc_undo.undo.data.rcvindex;
+	  rcv.length = sysop_end->mvcc_undo.undo.length;
+	  rcv.offset = sysop_end->mvcc_undo.undo.data.offset;
+	  rcv_vpid.volid = sysop_end->mvcc_undo.undo.data.volid;
+	  rcv_vpid.pageid = sysop_end->mvcc_undo.undo.data.pageid;
+	  rcv.mvcc_id = sysop_end->mvcc_undo.mvccid;
+
+	  /* will jump to parent LSA. save it now before advancing to undo data */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
+	  LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
+	  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), log_lsa, log_pgptr);
+	  log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			      undo_unzip_ptr);
+	}
+      else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_COMPENSATE)
+	{
+	  /* compensate */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->compensate_lsa);
+	}
+      else
+	{
+	  /* should not find run postpones on undo recovery */
+	  assert (sysop_end->type != LOG_SYSOP_END_LOGICAL_RUN_POSTPONE);
+
+	  /* jump to parent LSA */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
+	}
+      break;
+
+    case LOG_RUN_POSTPONE:
+    case LOG_COMMIT_WITH_POSTPONE:
+    case LOG_COMMIT_WITH_POSTPONE_OBSOLETE:
+    case LOG_COMMIT:
+    case LOG_SYSOP_START_POSTPONE:
+    case LOG_ABORT:
+    case LOG_START_CHKPT:
+    case LOG_END_CHKPT:
+    case LOG_2PC_PREPARE:
+    case LOG_2PC_START:
+    case LOG_2PC_ABORT_DECISION:
+    case LOG_2PC_COMMIT_DECISION:
+    case LOG_2PC_ABORT_INFORM_PARTICPS:
+    case LOG_2PC_COMMIT_INFORM_PARTICPS:
+    case LOG_2PC_RECV_ACK:
+    case LOG_DUMMY_CRASH_RECOVERY:
+    case LOG_END_OF_LOG:
+      /* This looks like a system error in the analysis phase */
+#if defined(CUBRID_DEBUG)
+      er_log_debug (ARG_FILE_LINE,
+		    "log_recovery_undo: SYSTEM ERROR for log located at %lld|%d,"
+		    " Bad log_rectype = %d\n (%s).\n", (long long int) log_lsa->pageid, log_lsa->offset,
+		    log_rtype, log_to_string (log_rtype));
+#endif /* CUBRID_DEBUG */
+      /* Remove the transaction from the recovery process */
+      assert (false);
+
+      /* Clear MVCCID */
+      tdes->mvccinfo.id = MVCCID_NULL;
+
+      if (logtb_is_system_worker_tranid (tran_id))
+	{
+	  // *INDENT-OFF*
+	  log_system_tdes::rv_delete_tdes (tran_id);
+	  // *INDENT-ON*
+	}
+      else
+	{
+	  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
+	  logtb_free_tran_index (thread_p, tran_index);
+	}
+      tdes = NULL;
+      break;
+
+    case LOG_SMALLER_LOGREC_TYPE:
+    case LOG_LARGER_LOGREC_TYPE:
+    default:
+#if defined(CUBRID_DEBUG)
+      er_log_debug (ARG_FILE_LINE,
+		    "log_recovery_undo: Unknown record type = %d (%s)\n ... May be a system error",
+		    log_rtype, log_to_string (log_rtype));
+#endif /* CUBRID_DEBUG */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, log_lsa->pageid);
+      assert (false);
+
+      /*
+       * Remove the transaction from the recovery process
+       */
+
+      /* Clear MVCCID */
+      tdes->mvccinfo.id = MVCCID_NULL;
+
+      if (logtb_is_system_worker_tranid (tran_id))
+	{
+	  // *INDENT-OFF*
+	  log_system_tdes::rv_delete_tdes (tran_id);
+	  // *INDENT-ON*
+	}
+      else
+	{
+	  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
+	  logtb_free_tran_index (thread_p, tran_index);
+	}
+      tdes = NULL;
+      break;
+    }
+
+  /* Just in case, it was changed */
+  if (tdes != NULL)
+    {
+      /* Is this the end of transaction? */
+      if (LSA_ISNULL (&prev_tranlsa))
+	{
+	  /* Clear MVCCID */
+	  tdes->mvccinfo.id = MVCCID_NULL;
+
+	  if (logtb_is_system_worker_tranid (tran_id))
+	    {
+	      // *INDENT-OFF*
+	      log_system_tdes::rv_delete_tdes (tran_id);
+	      // *INDENT-ON*
+	    }
+	  else
+	    {
+	      (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
+	      logtb_free_tran_index (thread_p, tran_index);
+	    }
+	  tdes = NULL;
+	}
+      else
+	{
+	  /* Update transaction next undo LSA */
+	  LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
+	}
+    }
+
+  return tdes;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * log_recovery_undo_transaction - roll back one worker transaction during recovery undo
+ *
+ * return: nothing
+ *
+ *   tdes(in/out): transaction descriptor
+ *
+ * NOTE: Runs on a recovery worker thread. The transaction is completed and its index is freed at the end.
+ */
+static void
+log_recovery_undo_transaction (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
+{
+  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  LOG_PAGE *log_pgptr = (LOG_PAGE *) PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
+  LOG_LSA log_lsa;
+  LOG_ZIP *undo_unzip_ptr = NULL;
+  int tran_index = tdes->tran_index;
+
+  undo_unzip_ptr = log_zip_alloc (LOGAREA_SIZE);
+  if (undo_unzip_ptr == NULL)
+    {
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_recovery_undo_transaction");
+      return;
+    }
+
+  while (tdes != NULL && !LSA_ISNULL (&tdes->undo_nxlsa))
+    {
+      LSA_COPY (&log_lsa, &tdes->undo_nxlsa);
+      if (logpb_fetch_page (thread_p, &log_lsa, LOG_CS_FORCE_USE, log_pgptr) != NO_ERROR)
+	{
+	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_recovery_undo_transaction");
+	  break;
+	}
+
+      tdes = log_recovery_undo_log_record (thread_p, tdes, tran_index, &log_lsa, log_pgptr, undo_unzip_ptr);
+    }
+
+  log_zip_free (undo_unzip_ptr);
+}
+
+/*
+ * log_recovery_undo_parallel - roll back the worker transactions concurrently on recovery threads
+ *
+ * return: nothing
+ *
+ * NOTE: Transactions active at the crash held their locks until then, so the rollback of one does not depend on
+ *       the rollback of another and each can be undone backwards on its own. System transactions are left to the
+ *       sequential undo. Nothing is done unless there are at least two worker transactions to undo.
+ */
+static void
+log_recovery_undo_parallel (THREAD_ENTRY * thread_p)
+{
+  // *INDENT-OFF*
+  std::vector<LOG_TDES *> undo_tdes;
+  std::mutex undo_mutex;
+  std::condition_variable undo_cv;
+  // *INDENT-ON*
+  std::size_t undo_remaining;
+  LOG_TDES *tdes;
+  int tran_index;
+
+  for (tran_index = 1; tran_index < log_Gl.trantable.num_total_indices; tran_index++)
+    {
+      tdes = LOG_FIND_TDES (tran_index);
+      if (tdes != NULL && tdes->trid != NULL_TRANID
+	  && (tdes->state == TRAN_UNACTIVE_UNILATERALLY_ABORTED || tdes->state == TRAN_UNACTIVE_ABORTED)
+	  && !LSA_ISNULL (&tdes->undo_nxlsa))
+	{
+	  undo_tdes.push_back (tdes);
+	}
+    }
+
+  if (undo_tdes.size () < 2)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  const std::size_t undo_parallel_count = MIN (undo_tdes.size (), (std::size_t) cubthread::system_core_count ());
+  cubthread::system_worker_entry_manager undo_context_manager (TT_RECOVERY);
+  cubthread::entry_workpool *undo_worker_pool =
+    cubthread::get_manager ()->create_worker_pool (undo_parallel_count, undo_tdes.size (),
+						   "log_recovery_undo_thread_pool", &undo_context_manager,
+						   undo_parallel_count, false /*debug_logging*/);
+  // *INDENT-ON*
+  if (undo_worker_pool == NULL)
+    {
+      /* undo sequentially */
+      return;
+    }
+
+  er_log_debug (ARG_FILE_LINE, "log_recovery_undo_parallel: %d transactions on %d threads\n", (int) undo_tdes.size (),
+		(int) undo_parallel_count);
+
+  /* workers fetch log pages and append compensation records; both need the log critical section */
+  LOG_CS_EXIT (thread_p);
+
+  undo_remaining = undo_tdes.size ();
+  // *INDENT-OFF*
+  for (LOG_TDES *undo_tdes_p : undo_tdes)
+    {
+      auto undo_func = [&, undo_tdes_p] (cubthread::entry & context)
+	{
+	  log_recovery_undo_transaction (&context, undo_tdes_p);
+
+	  std::unique_lock<std::mutex> ulock (undo_mutex);
+	  if (--undo_remaining == 0)
+	    {
+	      undo_cv.notify_one ();
+	    }
+	};
+      cubthread::get_manager ()->push_task (undo_worker_pool, new cubthread::entry_callable_task (undo_func));
+    }
+
+  {
+    std::unique_lock<std::mutex> ulock (undo_mutex);
+    undo_cv.wait (ulock, [&undo_remaining] { return undo_remaining == 0; });
+  }
+  // *INDENT-ON*
+
+  cubthread::get_manager ()->destroy_worker_pool (undo_worker_pool);
+
+  LOG_CS_ENTER (thread_p);
+}
+#endif /* SERVER_MODE */
+
+/*
+ * log_recovery_undo - SCAN BACKWARDS UNDOING DATA
+ *
+ * return: nothing
+ *
+ */
+static void
+log_recovery_undo (THREAD_ENTRY * thread_p, const cublog::perf_stats & rcv_phase_perf_stat)
+{
+  LOG_LSA max_undo_lsa = NULL_LSA;	/* LSA of log record to undo */
+  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_log_pgbuf;
+  LOG_PAGE *log_pgptr = NULL;	/* Log page pointer where LSA is located */
+  LOG_LSA log_lsa;
+  LOG_RECORD_HEADER *log_rec = NULL;	/* Pointer to log record */
   LOG_TDES *tdes;		/* Transaction descriptor */
   int tran_index;
-  int data_header_size = 0;
   LOG_ZIP *undo_unzip_ptr = NULL;
   int cnt_trans_to_undo = 0;
   LOG_LSA min_lsa = NULL_LSA;
   LOG_LSA max_lsa = NULL_LSA;
-  bool is_mvcc_op;
-  volatile TRANID tran_id;
-  volatile LOG_RECTYPE log_rtype;
+  TRANID tran_id;
   TSC_TICKS info_logging_start_time, info_logging_check_time;
   TSCTIMEVAL info_logging_elapsed_time;
   int info_logging_interval_in_secs = 0;
@@ -4526,6 +5030,15 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
       tsc_start_time_usec (&info_logging_check_time);
     }
 
+#if defined (SERVER_MODE)
+  /* roll back the worker transactions concurrently; what remains is undone below, backwards in log order */
+  log_recovery_undo_parallel (thread_p);
+
+  max_undo_lsa = NULL_LSA;
+  logtb_rv_read_only_map_undo_tdes (thread_p, max_undo_lsa_func);
+#endif /* SERVER_MODE */
+  rcv_phase_perf_stat.time_and_increment (cublog::PERF_STAT_ID_PHASE_UNDO_PARALLEL);
+
   while (!LSA_ISNULL (&max_undo_lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -4570,9 +5083,6 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
 	  log_rec = LOG_GET_LOG_RECORD_HEADER (log_pgptr, &log_lsa);
 
 	  tran_id = log_rec->trid;
-	  log_rtype = log_rec->type;
-
-	  LSA_COPY (&prev_tranlsa, &log_rec->prev_tranlsa);
 
 	  if (logtb_is_system_worker_tranid (tran_id))
 	    {
@@ -4613,329 +5123,7 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
 
 	  if (tran_index != NULL_TRAN_INDEX && tdes != NULL)
 	    {
-	      LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
-
-	      switch (log_rtype)
-		{
-		case LOG_MVCC_UNDOREDO_DATA:
-		case LOG_MVCC_DIFF_UNDOREDO_DATA:
-		case LOG_UNDOREDO_DATA:
-		case LOG_DIFF_UNDOREDO_DATA:
-		  LSA_COPY (&rcv_lsa, &log_lsa);
-		  /*
-		   * The transaction was active at the time of the crash. The
-		   * transaction is unilaterally aborted by the system
-		   */
-
-		  if (log_rtype == LOG_MVCC_UNDOREDO_DATA || log_rtype == LOG_MVCC_DIFF_UNDOREDO_DATA)
-		    {
-		      is_mvcc_op = true;
-		    }
-		  else
-		    {
-		      is_mvcc_op = false;
-		    }
-
-		  /* Get the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
-
-		  if (is_mvcc_op)
-		    {
-		      data_header_size = sizeof (LOG_REC_MVCC_UNDOREDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      mvcc_undoredo = (LOG_REC_MVCC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa.offset);
-
-		      /* Get undoredo info */
-		      undoredo = &mvcc_undoredo->undoredo;
-
-		      /* Save transaction MVCCID to recovery */
-		      rcv.mvcc_id = mvcc_undoredo->mvccid;
-		    }
-		  else
-		    {
-		      data_header_size = sizeof (LOG_REC_UNDOREDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      undoredo = (LOG_REC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa.offset);
-
-		      rcv.mvcc_id = MVCCID_NULL;
-		    }
-
-		  rcvindex = undoredo->data.rcvindex;
-		  rcv.length = undoredo->ulength;
-		  rcv.offset = undoredo->data.offset;
-		  rcv_vpid.volid = undoredo->data.volid;
-		  rcv_vpid.pageid = undoredo->data.pageid;
-
-		  LOG_READ_ADD_ALIGN (thread_p, data_header_size, &log_lsa, log_pgptr);
-
-#if !defined(NDEBUG)
-		  if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
-		    {
-		      fprintf (stdout,
-			       "TRACE UNDOING[1]: LSA = %lld|%d, Rv_index = %s,\n"
-			       "      volid = %d, pageid = %d, offset = %d,\n", (long long int) rcv_lsa.pageid,
-			       (int) rcv_lsa.offset, rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid,
-			       rcv.offset);
-		      fflush (stdout);
-		    }
-#endif /* !NDEBUG */
-
-		  log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-				      undo_unzip_ptr);
-		  break;
-
-		case LOG_MVCC_UNDO_DATA:
-		case LOG_UNDO_DATA:
-		  /* Does the record belong to a MVCC op? */
-		  is_mvcc_op = log_rtype == LOG_MVCC_UNDO_DATA;
-
-		  LSA_COPY (&rcv_lsa, &log_lsa);
-		  /*
-		   * The transaction was active at the time of the crash. The
-		   * transaction is unilaterally aborted by the system
-		   */
-
-		  /* Get the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
-
-		  if (is_mvcc_op)
-		    {
-		      data_header_size = sizeof (LOG_REC_MVCC_UNDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      mvcc_undo = (LOG_REC_MVCC_UNDO *) ((char *) log_pgptr->area + log_lsa.offset);
-
-		      /* Get undo info */
-		      undo = &mvcc_undo->undo;
-
-		      /* Save transaction MVCCID to recovery */
-		      rcv.mvcc_id = mvcc_undo->mvccid;
-		    }
-		  else
-		    {
-		      data_header_size = sizeof (LOG_REC_UNDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      undo = (LOG_REC_UNDO *) ((char *) log_pgptr->area + log_lsa.offset);
-
-		      rcv.mvcc_id = MVCCID_NULL;
-		    }
-
-		  rcvindex = undo->data.rcvindex;
-		  rcv.length = undo->length;
-		  rcv.offset = undo->data.offset;
-		  rcv_vpid.volid = undo->data.volid;
-		  rcv_vpid.pageid = undo->data.pageid;
-
-		  LOG_READ_ADD_ALIGN (thread_p, data_header_size, &log_lsa, log_pgptr);
-
-#if !defined(NDEBUG)
-		  if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
-		    {
-		      fprintf (stdout,
-			       "TRACE UNDOING[2]: LSA = %lld|%d, Rv_index = %s,\n"
-			       "      volid = %d, pageid = %d, offset = %hd,\n", LSA_AS_ARGS (&rcv_lsa),
-			       rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid, rcv.offset);
-		      fflush (stdout);
-		    }
-#endif /* !NDEBUG */
-		  log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-				      undo_unzip_ptr);
-		  break;
-
-		case LOG_REDO_DATA:
-		case LOG_MVCC_REDO_DATA:
-		case LOG_DBEXTERN_REDO_DATA:
-		case LOG_DUMMY_HEAD_POSTPONE:
-		case LOG_POSTPONE:
-		case LOG_SAVEPOINT:
-		case LOG_REPLICATION_DATA:
-		case LOG_REPLICATION_STATEMENT:
-		case LOG_DUMMY_HA_SERVER_STATE:
-		case LOG_DUMMY_OVF_RECORD:
-		case LOG_DUMMY_GENERIC:
-		case LOG_SUPPLEMENTAL_INFO:
-		case LOG_SYSOP_ATOMIC_START:
-		  /* Not for UNDO ... */
-		  /* Break switch to go to previous record */
-		  break;
-
-		case LOG_COMPENSATE:
-		  /* Only for REDO .. Go to next undo record Need to read the compensating record to set the next undo
-		   * address. */
-
-		  /* Get the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
-		  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_COMPENSATE), &log_lsa, log_pgptr);
-		  compensate = (LOG_REC_COMPENSATE *) ((char *) log_pgptr->area + log_lsa.offset);
-		  LSA_COPY (&prev_tranlsa, &compensate->undo_nxlsa);
-		  break;
-
-		case LOG_SYSOP_END:
-		  /*
-		   * We found a system top operation that should be skipped from
-		   * rollback
-		   */
-
-		  /* Read the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
-		  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_SYSOP_END), &log_lsa, log_pgptr);
-		  sysop_end = ((LOG_REC_SYSOP_END *) ((char *) log_pgptr->area + log_lsa.offset));
-
-		  if (sysop_end->type == LOG_SYSOP_END_LOGICAL_UNDO)
-		    {
-		      /* execute undo */
-		      rcvindex = sysop_end->undo.data.rcvindex;
-		      rcv.length = sysop_end->undo.length;
-		      rcv.offset = sysop_end->undo.data.offset;
-		      rcv_vpid.volid = sysop_end->undo.data.volid;
-		      rcv_vpid.pageid = sysop_end->undo.data.pageid;
-		      rcv.mvcc_id = MVCCID_NULL;
-
-		      /* will jump to parent LSA. save it now before advancing to undo data */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
-		      LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
-
-		      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), &log_lsa, log_pgptr);
-		      log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-					  undo_unzip_ptr);
-		    }
-		  else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_MVCC_UNDO)
-		    {
-		      /* execute undo */
-		      rcvindex = sysop_end->mvcc_undo.undo.data.rcvindex;
-		      rcv.length = sysop_end->mvcc_undo.undo.length;
-		      rcv.offset = sysop_end->mvcc_undo.undo.data.offset;
-		      rcv_vpid.volid = sysop_end->mvcc_undo.undo.data.volid;
-		      rcv_vpid.pageid = sysop_end->mvcc_undo.undo.data.pageid;
-		      rcv.mvcc_id = sysop_end->mvcc_undo.mvccid;
-
-		      /* will jump to parent LSA. save it now before advancing to undo data */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
-		      LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
-		      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), &log_lsa, log_pgptr);
-		      log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-					  undo_unzip_ptr);
-		    }
-		  else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_COMPENSATE)
-		    {
-		      /* compensate */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->compensate_lsa);
-		    }
-		  else
-		    {
-		      /* should not find run postpones on undo recovery */
-		      assert (sysop_end->type != LOG_SYSOP_END_LOGICAL_RUN_POSTPONE);
-
-		      /* jump to parent LSA */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
-		    }
-		  break;
-
-		case LOG_RUN_POSTPONE:
-		case LOG_COMMIT_WITH_POSTPONE:
-		case LOG_COMMIT_WITH_POSTPONE_OBSOLETE:
-		case LOG_COMMIT:
-		case LOG_SYSOP_START_POSTPONE:
-		case LOG_ABORT:
-		case LOG_START_CHKPT:
-		case LOG_END_CHKPT:
-		case LOG_2PC_PREPARE:
-		case LOG_2PC_START:
-		case LOG_2PC_ABORT_DECISION:
-		case LOG_2PC_COMMIT_DECISION:
-		case LOG_2PC_ABORT_INFORM_PARTICPS:
-		case LOG_2PC_COMMIT_INFORM_PARTICPS:
-		case LOG_2PC_RECV_ACK:
-		case LOG_DUMMY_CRASH_RECOVERY:
-		case LOG_END_OF_LOG:
-		  /* This looks like a system error in the analysis phase */
-#if defined(CUBRID_DEBUG)
-		  er_log_debug (ARG_FILE_LINE,
-				"log_recovery_undo: SYSTEM ERROR for log located at %lld|%d,"
-				" Bad log_rectype = %d\n (%s).\n", (long long int) log_lsa.pageid, log_lsa.offset,
-				log_rtype, log_to_string (log_rtype));
-#endif /* CUBRID_DEBUG */
-		  /* Remove the transaction from the recovery process */
-		  assert (false);
-
-		  /* Clear MVCCID */
-		  tdes->mvccinfo.id = MVCCID_NULL;
-
-		  if (logtb_is_system_worker_tranid (tran_id))
-		    {
-		      // *INDENT-OFF*
-		      log_system_tdes::rv_delete_tdes (tran_id);
-		      // *INDENT-ON*
-		    }
-		  else
-		    {
-		      (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
-		      logtb_free_tran_index (thread_p, tran_index);
-		    }
-		  tdes = NULL;
-		  break;
-
-		case LOG_SMALLER_LOGREC_TYPE:
-		case LOG_LARGER_LOGREC_TYPE:
-		default:
-#if defined(CUBRID_DEBUG)
-		  er_log_debug (ARG_FILE_LINE,
-				"log_recovery_undo: Unknown record type = %d (%s)\n ... May be a system error",
-				log_rtype, log_to_string (log_rtype));
-#endif /* CUBRID_DEBUG */
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, log_lsa.pageid);
-		  assert (false);
-
-		  /*
-		   * Remove the transaction from the recovery process
-		   */
-
-		  /* Clear MVCCID */
-		  tdes->mvccinfo.id = MVCCID_NULL;
-
-		  if (logtb_is_system_worker_tranid (tran_id))
-		    {
-		      // *INDENT-OFF*
-		      log_system_tdes::rv_delete_tdes (tran_id);
-		      // *INDENT-ON*
-		    }
-		  else
-		    {
-		      (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
-		      logtb_free_tran_index (thread_p, tran_index);
-		    }
-		  tdes = NULL;
-		  break;
-		}
-
-	      /* Just in case, it was changed */
-	      if (tdes != NULL)
-		{
-		  /* Is this the end of transaction? */
-		  if (LSA_ISNULL (&prev_tranlsa))
-		    {
-		      /* Clear MVCCID */
-		      tdes->mvccinfo.id = MVCCID_NULL;
-
-		      if (logtb_is_system_worker_tranid (tran_id))
-			{
-			  // *INDENT-OFF*
-			  log_system_tdes::rv_delete_tdes (tran_id);
-			  // *INDENT-ON*
-			}
-		      else
-			{
-			  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID,
-					       LOG_NEED_TO_WRITE_EOT_LOG);
-			  logtb_free_tran_index (thread_p, tran_index);
-			  tdes = NULL;
-			}
-		    }
-		  else
-		    {
-		      /* Update transaction next undo LSA */
-		      LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
-		    }
-		}
+	      (void) log_recovery_undo_log_record (thread_p, tdes, tran_index, &log_lsa, log_pgptr, undo_unzip_ptr);
 	    }
 
 	  /* Find the next log record to undo */
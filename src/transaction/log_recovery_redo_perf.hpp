@@ -95,6 +95,28 @@ namespace cublog
 			      "Counter retire", "Timer retire (ms)"),
   };
 
+  /* used to evaluate the duration of each log recovery phase on the main thread
+   */
+  enum : cubperf::stat_id
+  {
+    PERF_STAT_ID_PHASE_ANALYSIS,
+    PERF_STAT_ID_PHASE_REDO,
+    PERF_STAT_ID_PHASE_UNDO_PARALLEL,
+    PERF_STAT_ID_PHASE_UNDO,
+  };
+
+  static constexpr cubperf::statset_definition::init_list_t perf_stats_phase_definition_init_list
+  {
+    cubperf::stat_definition (PERF_STAT_ID_PHASE_ANALYSIS, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter analysis", "Timer analysis (ms)"),
+    cubperf::stat_definition (PERF_STAT_ID_PHASE_REDO, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter redo", "Timer redo (ms)"),
+    cubperf::stat_definition (PERF_STAT_ID_PHASE_UNDO_PARALLEL, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter undo_parallel", "Timer undo_parallel (ms)"),
+    cubperf::stat_definition (PERF_STAT_ID_PHASE_UNDO, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter undo", "Timer undo (ms)"),
+  };
+
   /* collect and log performance statistics based on a supplied definition
    *
    * Usage:
@@ -1472,6 +1472,7 @@ logtb_free_tran_mvcc_info (LOG_TDES * tdes)
   MVCC_INFO *curr_mvcc_info = &tdes->mvccinfo;
 
   curr_mvcc_info->snapshot.m_active_mvccs.finalize ();
+  curr_mvcc_info->snapshot.has_trans_status_version = false;
   curr_mvcc_info->sub_ids.clear ();
 }
 
@@ -1825,6 +1826,51 @@ logtb_find_tran_index (THREAD_ENTRY * thread_p, TRANID trid)
   return tran_index;
 }
 
+/*
+ * logtb_find_tran_index_by_mvccid - find index of the transaction that owns an MVCCID
+ *
+ * return: tran index or NULL_TRAN_INDEX
+ *
+ *   mvccid(in): MVCC identifier of the transaction or of one of its sub-transactions
+ *
+ * Note: Sequential search in the transaction table, like logtb_find_tran_index. It is only used when a lock conflict
+ *       has to be materialized, so it is not on a common path.
+ */
+int
+logtb_find_tran_index_by_mvccid (THREAD_ENTRY * thread_p, MVCCID mvccid)
+{
+  int i;
+  int tran_index = NULL_TRAN_INDEX;
+  LOG_TDES *tdes;
+
+  assert (MVCCID_IS_VALID (mvccid));
+
+  TR_TABLE_CS_ENTER_READ_MODE (thread_p);
+  for (i = 1; i < NUM_TOTAL_TRAN_INDICES && tran_index == NULL_TRAN_INDEX; i++)
+    {
+      tdes = log_Gl.trantable.all_tdes[i];
+      if (tdes == NULL || tdes->trid == NULL_TRANID)
+	{
+	  continue;
+	}
+
+      if (tdes->mvccinfo.id == mvccid)
+	{
+	  tran_index = i;
+	  break;
+	}
+    }
+  TR_TABLE_CS_EXIT (thread_p);
+
+  if (tran_index == NULL_TRAN_INDEX)
+    {
+      /* sub-transaction vectors belong to their owners; use the owners recorded by the MVCC table instead */
+      tran_index = log_Gl.mvcc_table.find_sub_mvccid_owner (mvccid);
+    }
+
+  return tran_index;
+}
+
 #if defined (ENABLE_UNUSED_FUNCTION)
 /*
  * logtb_find_tran_index_host_pid - find index of transaction
@@ -4524,6 +4570,7 @@ logtb_assign_subtransaction_mvccid (THREAD_ENTRY * thread_p, MVCC_INFO * curr_mv
   assert (curr_mvcc_info != NULL);
   assert (MVCCID_IS_VALID (curr_mvcc_info->id));
   curr_mvcc_info->sub_ids.push_back (mvcc_subid);
+  log_Gl.mvcc_table.register_sub_mvccid (mvcc_subid, LOG_FIND_THREAD_TRAN_INDEX (thread_p));
 }
 
 /*
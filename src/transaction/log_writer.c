@@ -53,6 +53,7 @@
 #if defined(SERVER_MODE)
 #include "log_append.hpp"
 #include "log_manager.h"
+#include "perf_monitor.h"
 #include "server_support.h"
 #include "network_interface_sr.h"
 #else /* !defined(SERVER_MODE) */
@@ -133,6 +134,10 @@ LOGWR_GLOBAL logwr_Gl = {
   0,
   /* logpg_fill_size */
   0,
+  /* logpg_zip */
+  NULL,
+  /* logpg_unzip */
+  NULL,
   /* toflush */
   NULL,
   /* max_toflush */
@@ -595,6 +600,16 @@ logwr_finalize (void)
       logwr_Gl.logpg_fill_size = 0;
       logwr_Gl.loghdr_pgptr = NULL;
     }
+  if (logwr_Gl.logpg_zip != NULL)
+    {
+      log_zip_free (logwr_Gl.logpg_zip);
+      logwr_Gl.logpg_zip = NULL;
+    }
+  if (logwr_Gl.logpg_unzip != NULL)
+    {
+      log_zip_free (logwr_Gl.logpg_unzip);
+      logwr_Gl.logpg_unzip = NULL;
+    }
   if (logwr_Gl.toflush != NULL)
     {
       free_and_init (logwr_Gl.toflush);
@@ -2108,6 +2123,8 @@ static void logwr_write_end (THREAD_ENTRY * thread_p, LOGWR_INFO * writer_info,
 static void logwr_set_eof_lsa (THREAD_ENTRY * thread_p, LOGWR_ENTRY * entry);
 static bool logwr_is_delayed (THREAD_ENTRY * thread_p, LOGWR_ENTRY * entry);
 static void logwr_update_last_sent_eof_lsa (LOGWR_ENTRY * entry);
+static int logwr_send_log_pages (THREAD_ENTRY * thread_p, char *logpg_area, int logpg_used_size, LOGWR_MODE mode,
+				 LOG_ZIP * logpg_zip);
 
 /*
  * logwr_register_writer_entry -
@@ -2557,6 +2574,52 @@ logwr_update_last_sent_eof_lsa (LOGWR_ENTRY * entry)
   return;
 }
 
+/*
+ * logwr_send_log_pages - send the packed log pages to copylogdb
+ *
+ * return: error code
+ *
+ *   thread_p(in):
+ *   logpg_area(in): packed log pages
+ *   logpg_used_size(in): size of packed log pages
+ *   mode(in):
+ *   logpg_zip(in): compression area, or NULL if copylogdb did not ask for compressed log pages
+ *
+ * Note: the pages are sent uncompressed when LZ4 does not make them smaller.
+ */
+static int
+logwr_send_log_pages (THREAD_ENTRY * thread_p, char *logpg_area, int logpg_used_size, LOGWR_MODE mode,
+		      LOG_ZIP * logpg_zip)
+{
+  PERF_UTIME_TRACKER time_track;
+  int sent_size;
+  int error_code;
+
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
+
+  if (logpg_zip != NULL && log_zip (logpg_zip, logpg_used_size, logpg_area))
+    {
+      sent_size = logpg_zip->data_length;
+      error_code = xlog_send_log_pages_to_client (thread_p, logpg_zip->log_data, sent_size, mode, true);
+    }
+  else
+    {
+      sent_size = logpg_used_size;
+      error_code = xlog_send_log_pages_to_client (thread_p, logpg_area, sent_size, mode, false);
+    }
+
+  if (error_code == NO_ERROR)
+    {
+      perfmon_add_stat (thread_p, PSTAT_LOGWR_NUM_SENT_PAGES, logpg_used_size / LOG_PAGESIZE);
+      perfmon_add_stat (thread_p, PSTAT_LOGWR_NUM_RAW_BYTES, logpg_used_size);
+      perfmon_add_stat (thread_p, PSTAT_LOGWR_NUM_SENT_BYTES, sent_size);
+    }
+
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_LOGWR_SEND_TIME_COUNTERS);
+
+  return error_code;
+}
+
 /*
  * xlogwr_get_log_pages -
  *
@@ -2588,6 +2651,7 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
   struct timespec to;
   LOGWR_INFO *writer_info = log_Gl.writer_info;
   bool copy_from_first_phy_page = false;
+  LOG_ZIP *logpg_zip = NULL;
 
   logpg_used_size = 0;
   logpg_area = (char *) db_private_alloc (thread_p, (LOGWR_COPY_LOG_BUFFER_NPAGES * LOG_PAGESIZE));
@@ -2611,7 +2675,16 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
 	{
 	  copy_from_first_phy_page = false;
 	}
-      mode = (LOGWR_MODE) (mode & ~LOGWR_COPY_FROM_FIRST_PHY_PAGE_MASK);
+      if ((mode & LOGWR_COMPRESS_LOG_PAGES_MASK) && logpg_zip == NULL)
+	{
+	  /* copylogdb asked for compressed log pages; if the area cannot be allocated, send them raw */
+	  logpg_zip = log_zip_alloc (LOGWR_COPY_LOG_BUFFER_NPAGES * LOG_PAGESIZE);
+	  if (logpg_zip == NULL)
+	    {
+	      er_clear ();
+	    }
+	}
+      mode = (LOGWR_MODE) (mode & ~(LOGWR_COPY_FROM_FIRST_PHY_PAGE_MASK | LOGWR_COMPRESS_LOG_PAGES_MASK));
 
       /* In case that a non-ASYNC mode client internally uses ASYNC mode */
       orig_mode = MAX (mode, orig_mode);
@@ -2760,7 +2833,7 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
 	  need_cs_exit_after_send = false;
 	}
 
-      error_code = xlog_send_log_pages_to_client (thread_p, logpg_area, logpg_used_size, mode);
+      error_code = logwr_send_log_pages (thread_p, logpg_area, logpg_used_size, mode, logpg_zip);
       if (error_code != NO_ERROR)
 	{
 	  status = LOGWR_STATUS_ERROR;
@@ -2811,6 +2884,10 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
     }
 
   db_private_free_and_init (thread_p, logpg_area);
+  if (logpg_zip != NULL)
+    {
+      log_zip_free (logpg_zip);
+    }
 
   assert_release (false);
   return ER_FAILED;
@@ -2823,6 +2900,10 @@ error:
   logwr_write_end (thread_p, writer_info, entry, status);
 
   db_private_free_and_init (thread_p, logpg_area);
+  if (logpg_zip != NULL)
+    {
+      log_zip_free (logpg_zip);
+    }
 
   return error_code;
 }
@@ -28,6 +28,7 @@
 #include "client_credentials.hpp"
 #include "log_archives.hpp"
 #include "log_common_impl.h"
+#include "log_compress.h"
 #include "log_lsa.hpp"
 #include "tde.h"
 #include "storage_common.h"
@@ -53,6 +54,7 @@ enum logwr_mode
 };
 typedef enum logwr_mode LOGWR_MODE;
 #define LOGWR_COPY_FROM_FIRST_PHY_PAGE_MASK	(0x80000000)
+#define LOGWR_COMPRESS_LOG_PAGES_MASK		(0x40000000)
 
 #if defined(CS_MODE)
 enum logwr_action
@@ -81,6 +83,8 @@ struct logwr_global
   char *logpg_area;
   int logpg_area_size;
   int logpg_fill_size;
+  LOG_ZIP *logpg_zip;		/* compressed log pages received from the server */
+  LOG_ZIP *logpg_unzip;		/* decompressed log pages, before being copied into logpg_area */
 
   LOG_PAGE **toflush;
   int max_toflush;
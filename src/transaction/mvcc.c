@@ -658,6 +658,8 @@ mvcc_snapshot::mvcc_snapshot ()
   , m_active_mvccs ()
   , snapshot_fnc (NULL)
   , valid (false)
+  , trans_status_version (0)
+  , has_trans_status_version (false)
 {
 }
 
@@ -671,6 +673,7 @@ mvcc_snapshot::reset ()
   m_active_mvccs.reset ();
 
   valid = false;
+  has_trans_status_version = false;
 }
 
 void
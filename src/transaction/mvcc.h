@@ -177,6 +177,11 @@ struct mvcc_snapshot
 
   bool valid;			/* true, if the snapshot is valid */
 
+  /* version of the transaction status m_active_mvccs was copied from; while no transaction completes, the status
+   * keeps this version and the next snapshot can reuse m_active_mvccs instead of copying it again */
+  unsigned int trans_status_version;
+  bool has_trans_status_version;
+
   // *INDENT-OFF*
   mvcc_snapshot ();
   void reset ();
@@ -172,6 +172,8 @@ mvcctable::mvcctable ()
   , m_active_trans_mutex ()
   , m_oldest_visible (MVCCID_NULL)
   , m_ov_lock_count (0)
+  , m_sub_mvccid_owners ()
+  , m_sub_mvccid_owners_mutex ()
 {
 }
 
@@ -220,6 +222,8 @@ mvcctable::finalize ()
   delete [] m_transaction_lowest_visible_mvccids;
   m_transaction_lowest_visible_mvccids = NULL;
   m_transaction_lowest_visible_mvccids_size = 0;
+
+  m_sub_mvccid_owners.clear ();
 }
 
 void
@@ -237,6 +241,7 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   TSCTIMEVAL tv_diff;
   UINT64 snapshot_wait_time;
   UINT64 snapshot_retry_count = 0;
+  bool is_snapshot_reused = false;
 
   assert (tdes.tran_index >= 0 && tdes.tran_index < logtb_get_number_of_total_tran_indices ());
 
@@ -297,8 +302,19 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       const mvcc_trans_status &trans_status = m_trans_status_history[index];
 
       trans_status_version = trans_status.m_version.load ();
-      trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
-					   mvcc_active_tran::copy_safety::THREAD_UNSAFE);
+      if (tdes.mvccinfo.snapshot.has_trans_status_version
+	  && tdes.mvccinfo.snapshot.trans_status_version == trans_status_version)
+	{
+	  // no transaction completed since the previous snapshot of this transaction was built (e.g. the previous
+	  // statement in READ COMMITTED); its active MVCCIDs are still exact, so skip copying them
+	  is_snapshot_reused = true;
+	}
+      else
+	{
+	  tdes.mvccinfo.snapshot.has_trans_status_version = false;
+	  trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
+					       mvcc_active_tran::copy_safety::THREAD_UNSAFE);
+	}
 
       if (logtb_load_global_statistics_to_tran (thread_get_thread_entry_info())!= NO_ERROR)
 	{
@@ -316,14 +332,27 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	  // a failed copy may break data validity; to make sure next copy is not affected, it is better to reset
 	  // bit area.
 	  tdes.mvccinfo.snapshot.m_active_mvccs.reset_active_transactions ();
+	  tdes.mvccinfo.snapshot.has_trans_status_version = false;
+	  is_snapshot_reused = false;
 	}
     }
 
-  // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
-  tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
+  if (is_snapshot_reused)
+    {
+      // highest completed MVCCID is also unchanged
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.highest_completed_mvccid;
+    }
+  else
+    {
+      // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
+      tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
 
-  highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
-  MVCCID_FORWARD (highest_completed_mvccid);
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
+      MVCCID_FORWARD (highest_completed_mvccid);
+
+      tdes.mvccinfo.snapshot.trans_status_version = trans_status_version;
+      tdes.mvccinfo.snapshot.has_trans_status_version = true;
+    }
 
   /* update lowest active mvccid computed for the most recent snapshot */
   tdes.mvccinfo.recent_snapshot_lowest_active_mvccid = crt_status_lowest_active;
@@ -348,6 +377,10 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	  perfmon_add_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
 			    snapshot_retry_count - 1);
 	}
+      if (is_snapshot_reused)
+	{
+	  perfmon_inc_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS);
+	}
     }
 }
 
@@ -542,6 +575,10 @@ mvcctable::complete_sub_mvcc (MVCCID mvccid)
 {
   assert (MVCCID_IS_VALID (mvccid));
 
+  m_sub_mvccid_owners_mutex.lock ();
+  m_sub_mvccid_owners.erase (mvccid);
+  m_sub_mvccid_owners_mutex.unlock ();
+
   // only one can change status at a time
   std::unique_lock<std::mutex> ulock (m_active_trans_mutex);
 
@@ -562,6 +599,24 @@ mvcctable::complete_sub_mvcc (MVCCID mvccid)
   // mvccid can't be lowest, so no need to update it here
 }
 
+void
+mvcctable::register_sub_mvccid (MVCCID mvccid, int tran_index)
+{
+  assert (MVCCID_IS_VALID (mvccid));
+
+  std::lock_guard<std::mutex> lock (m_sub_mvccid_owners_mutex);
+  m_sub_mvccid_owners[mvccid] = tran_index;
+}
+
+int
+mvcctable::find_sub_mvccid_owner (MVCCID mvccid) const
+{
+  std::lock_guard<std::mutex> lock (m_sub_mvccid_owners_mutex);
+
+  auto it = m_sub_mvccid_owners.find (mvccid);
+  return it != m_sub_mvccid_owners.end () ? it->second : NULL_TRAN_INDEX;
+}
+
 MVCCID
 mvcctable::get_new_mvccid ()
 {
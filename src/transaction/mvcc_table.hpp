@@ -32,6 +32,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 // forward declarations
 struct log_tdes;
@@ -79,6 +80,8 @@ class mvcctable
     void build_mvcc_info (log_tdes &tdes);
     void complete_mvcc (int tran_index, MVCCID mvccid, bool committed);
     void complete_sub_mvcc (MVCCID mvccid);
+    void register_sub_mvccid (MVCCID mvccid, int tran_index);
+    int find_sub_mvccid_owner (MVCCID mvccid) const;
     MVCCID get_new_mvccid ();
     void get_two_new_mvccid (MVCCID &first, MVCCID &second);
 
@@ -118,6 +121,10 @@ class mvcctable
     std::atomic<MVCCID> m_oldest_visible;
     std::atomic<size_t> m_ov_lock_count;
 
+    /* owners of active sub-transaction MVCCIDs, so other transactions never read a tdes sub_ids vector */
+    std::unordered_map<MVCCID, int> m_sub_mvccid_owners;
+    mutable std::mutex m_sub_mvccid_owners_mutex;
+
     mvcc_trans_status &next_trans_status_start (mvcc_trans_status::version_type &next_version, size_t &next_index);
     void next_tran_status_finish (mvcc_trans_status &next_trans_status, size_t next_index);
     void advance_oldest_active (MVCCID next_oldest_active);